@@ -29,6 +29,11 @@
 #
 # Make environment variables that might be useful:
 #
+#     LPC2XXX_PART_01
+#       Set this to 1 when MODEL is an LPC213x/01 part, to enable the
+#       registers that only the /01 revision has (UART fractional
+#       divider / auto-baud, ADC per-channel data / status).
+#
 #     LPC2XXX_NO_INTERWORK
 #       Set this to 2 to prevent "-mthumb-interwork" from being added
 #       to the compiler's flags.
@@ -75,6 +80,10 @@ endif
 # For the lpc2xxx device library's use
 LPC2XXXLIB_FLAGS := -D$(LPC2XXX_MODEL) -DF_CPU=$(F_CPU) -DHSE_Val=$(HSE_Val)
 
+ifeq ("$(LPC2XXX_PART_01)","1")
+  LPC2XXXLIB_FLAGS += -DLPC2XXX_PART_01
+endif
+
 # CPU machine flags
 override LPC2XXX_MACHINE_FLAGS   += -mlittle-endian -mlong-calls -msoft-float -mcpu=$(CPU)
 
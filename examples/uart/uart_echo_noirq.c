@@ -148,14 +148,6 @@ uint8_t uart_getchar(UART_Type *uart)
   */
 void init_uart(UART_Type *uart, uint32_t baud)
 {
-    uint32_t uart_divisor;
-    uint32_t apb_clock;
-    
-    
-    /* Determine the UART divisor for the given baud rate. */
-    apb_clock = SystemCoreClock / SYSCON_GetAPBClockDivider();
-    uart_divisor = ((apb_clock / 16) + (baud / 2)) / baud;
-
 #if (LPC2XXX_MODEL == 2148) || (LPC2XXX_MODEL == 2138) || (LPC2XXX_MODEL == 2106) \
     || (LPC2XXX_MODEL == 2103)
 
@@ -188,7 +180,7 @@ void init_uart(UART_Type *uart, uint32_t baud)
 #endif
 
     /* Configure baud rate & terminal settings (given baud @ 8n2) */
-    UART_SetDivisor(uart, uart_divisor);
+    UART_SetBaudRate(uart, baud);
     UART_SetWordLength(uart, UART_WordLength_8b);
     UART_SetStopBits(uart, UART_StopBits_2);
     UART_SetParity(UART, UART_Parity_No);
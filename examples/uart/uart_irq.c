@@ -35,99 +35,93 @@
  * policies, either expressed or implied, of Timothy Twilllman.
  *****************************************************************************/
 
-#include "system_LPC2xxx.h"
-#include "LPC2xxx_pinconfig.h"
-#include "LPC2xxx_uart.h"
+/* Includes -----------------------------------------------------------------*/
 
-unsigned char rxbuf[16];
-unsigned char rxbuf_start;
-unsigned char rxbuf_end;
+#include <stdint.h>
 
-unsigned char txbuf[16];
-unsigned char txbuf_start;
-unsigned char txbuf_end;
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart.h"           /* For UART interface           */
+#include "LPC2xxx_uart_buffered.h"  /* For buffered UART IO         */
+#include "LPC2xxx_uart_dispatch.h"  /* For the shared UART handler  */
+#include "LPC2xxx_vic.h"            /* For interrupt routing        */
+#include "LPC2xxx_syscon.h"         /* For peripheral power control */
+#include "LPC2xxx_pinsel.h"         /* For IO pin configuration     */
+#include "LPC2xxx_pinconfig.h"      /* For IO pin configuration     */
+#include "system_LPC2xxx.h"         /* For SystemCoreClock          */
 
 
-void UART1_IRQHandler(void) __attribute__((__IRQ__));
-void UART1_IRQHandler(void)
-{
-    while ((itid = UART_GetPendingITID(UART0)) != UART_ITID_None) {
-        if (itid == UART_ITID_RxLineStatus) {
-            tmp = UART_GetLineStatus(UART);
-            if (tmp & UART_BI) { /* BREAK */
-            } else if (tmp & (UART_OE | UART_PE | UART_FE)) {
-                /* Overflow / Parity / Framing Error */
-            }
-            
-            UART_Recv(UART0);
-            continue;
-        } else if ((itid == UART_ITID_RxDataAvailable) 
-                || (itid == UART_ITID_CharacterTimeout))
-        {
-            tmp = UART_Recv(UART);
-        } else if (itid == UART_ITID_TxEmpty) {
-        } else if (itid == UART_ITID_ModemStatus) {
-        } else {
-            /* UART_ITID_CharacterTimeOut */
-        }
-        
-        
-    }
-}
+/* Defines ------------------------------------------------------------------*/
+
+/* Default to 115200 baud */
+#ifndef BAUD
+# define BAUD 115200
+#endif
+
 
-int init_uart(UART_Type *uart, IRQn_Type uart_irq_num, uint32_t baud)
+/* Variables ----------------------------------------------------------------*/
+
+static uint8_t rxbuf[128];
+static uint8_t txbuf[256];
+
+static UARTBuf_Type ub;
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Initialize UART0 for interrupt-driven communication.
+  *
+  * @param  [in]  baud     Baud rate to configure on the UART
+  *
+  * @return None.
+  */
+void init_uart(uint32_t baud)
 {
-    uint32_t uart_divisor;
-    uint32_t apb_clock;
-    
-    
-    /* Determine the UART divisor for the given baud rate. */
-    apb_clock = SystemCoreClock / SYSCON_GetAPBClockDivider();
-    uart_divisor = ((apb_clock / 16) + (baud / 2)) / baud;
-
-    /* Configure baud rate & other settings */
-    UART_SetDivisor(uart, uart_divisor);
-    UART_SetWordLength(uart, UART_WordLength_8b);
-    UART_SetStopBits(uart, UART_StopBits_1);
-    UART_SetParity(uart, UART_Parity_No);
-
-    /* Enable UART FIFOs (necessary) */
-    UART_EnableFifos(uart);
-
-    /* Flush out the FIFOs */
-    UART_FlushRxFifo(uart);
-    UART_FlushTxFifo(uart);
-    
-    /* Set the UART Rx to interrupt on every incoming byte */
-    UART_SetRxFifoTrigger(uart, UART_RxFifoTrigger_1);
-
-    /* Enable Tx */
-    UART_EnableTx(uart);
+    /* Configure pins & power on UART0 */
+    PINSEL_SetPinConfig(PINSEL_PinConfig_0_0_TXD0);
+    PINSEL_SetPinConfig(PINSEL_PinConfig_0_1_RXD0);
+    SYSCON_EnablePeriphPowerLines(SYSCON_PeriphPowerLine_UART0);
+
+    /* Configure baud rate & terminal settings (given baud @ 8n1) */
+    UART_SetBaudRate(UART0, baud);
+    UART_SetWordLength(UART0, UART_WordLength_8b);
+    UART_SetStopBits(UART0, UART_StopBits_1);
+    UART_SetParity(UART0, UART_Parity_No);
+    UART_EnableTx(UART0);
+
+    /* Hand the UART over to the buffered layer; interrupt every 8 bytes */
+    UARTBuf_Init(&ub, UART0, UART0_IRQn, rxbuf, sizeof(rxbuf),
+                 txbuf, sizeof(txbuf), UART_RxFifoTrigger_8);
+
+    /* Route it through VIC slot 0 to the shared UART handler */
+    UARTDispatch_Attach(0, &ub, 0);
 }
 
+
+/** @brief  Main function for buffered UART example / test program.
+  *
+  * @return None (never returns).
+  *
+  * Echoes whatever is received, in whatever size chunks it arrives.
+  */
 int main()
 {
-    /* Disable the IRQ for the UART */
-    VIC_DisableIRQ(UART0_IRQn);
-    
-    /* Set up the pin configuration for the UART TXD/RXD pins */
-#if defined(lpc2103) || defined(lpc2102) || defined(lpc2101) 
-    PINSEL_SetPinConfig(PINSEL_PinConfig_0_1_RXD0);
-    PINSEL_SetPinConfig(PINSEL_PinConfig_0_0_TXD0);
-#endif
+    static const uint8_t banner[] = "Now echoing characters: ";
+    uint8_t buf[32];
+    uint16_t len;
 
-    /* Enable power to the UART */
-    SYSCON_EnablePeriphPowerLines(SYSCON_PeriphPowerLine_UART0);
 
-    init_uart(UART0, 115200);
-    
-    /* Set up VIC slot 0 to handle the UART */
-    VIC_SetSlot(0, UART0_IRQn, UART0_Handler);
-    VIC_EnableSlot(0);
-    
-    /* Enable interrupts for the UART in the VIC */
-    VIC_EnableIRQ(UART0_IRQn);
-
-    /* Start the UART interrupts going... */
-    UART_GetPendingITID(UART0);
+    init_uart(BAUD);
+
+    UARTBuf_Write(&ub, banner, sizeof(banner) - 1);
+
+    while(1) {
+        len = UARTBuf_Read(&ub, buf, sizeof(buf));
+        if (len) {
+            /* Spin until it's all queued up */
+            uint16_t sent = 0;
+            while (sent < len) {
+                sent += UARTBuf_Write(&ub, buf + sent, len - sent);
+            }
+        }
+    }
 }
@@ -224,7 +224,10 @@ typedef struct {
     __I     uint32_t    LSR;           /*!< Offset: 0x14 Line Status Register                    */
     __I     uint32_t    MSR;           /*!< Offset: 0x18 Modem Status Register                   */
     __IO    uint32_t    SCR;           /*!< Offset: 0x1C Scratch Pad Register                    */
-            uint32_t      Reserved8_11[4];
+    __IO    uint32_t    ACR;           /*!< Offset: 0x20 Auto-baud Control Register              */
+            uint32_t      Reserved9;
+    __IO    uint32_t    FDR;           /*!< Offset: 0x28 Fractional Divider Register             */
+            uint32_t      Reserved11;
     __IO    uint32_t    TER;           /*!< Offset: 0x30 Transmit Enable Register                */
 } UART_Type;
 
@@ -455,6 +458,9 @@ typedef struct {
     /* Note: GSR is available ONLY on AD0 */
 
     __O     uint32_t    GSR;           /*!< Offset: 0x08 Global Start Register                   */
+    __IO    uint32_t    INTEN;         /*!< Offset: 0x0C Interrupt Enable Register               */
+    __I     uint32_t    CHDR[8];       /*!< Offset: 0x10 Channel Data Registers 0-7              */
+    __I     uint32_t    STAT;          /*!< Offset: 0x30 Status Register                         */
 } ADC_Type;
 
 /**
@@ -1144,6 +1150,8 @@ typedef struct {
   */
 
 #define LPC2XXX_HAS_UART
+#define LPC2XXX_HAS_UART_FDR
+#define LPC2XXX_HAS_UART_AUTOBAUD
 
 /** @defgroup UART_RBR_Bit_Definitions (UxRBR) UART Receive Buffer Register Bit Definitions
   *
@@ -1358,6 +1366,24 @@ typedef struct {
 #define UART_AUTORESTART               (1 << 2)            /*!< Autobaud Restart on Timeout      */
 #define UART_ABEOIRQCLR                (1 << 8)            /*!< Clear ABEO Interrupt             */
 #define UART_OBTOIRQCLR                (1 << 9)            /*!< Clear ABTO Interrupt             */
+#define UART_ABTOIRQCLR                (1 << 9)            /*!< Clear ABTO Interrupt             */
+
+/**
+  * @}
+  */
+
+/** @defgroup UART_FDR_Bit_Definitions (UxFDR) UART Fractional Divider Register Bit Definitions
+  *
+  * @{
+  */
+
+#define UART_FDR_Mask                  (0xff)              /*!< Useable Bits in UART FDR Reg.    */
+#define UART_FDR_Shift                 (0)
+
+#define UART_DIVADDVAL_Mask            (0x0f)              /*!< Baud Rate Pre-Scaler Divisor     */
+#define UART_DIVADDVAL_Shift           (0)
+#define UART_MULVAL_Mask               (0x0f << 4)         /*!< Baud Rate Pre-Scaler Multiplier  */
+#define UART_MULVAL_Shift              (4)
 
 /**
   * @}
@@ -2177,6 +2203,7 @@ typedef struct {
   */
 
 #define LPC2XXX_HAS_ADC
+#define LPC2XXX_HAS_ADC_CHANNEL_REGS
 
 /** @defgroup ADC_CR_Bit_Definitions (ADCxCR) ADC Control Register Bit Definitions
   *
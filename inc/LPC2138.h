@@ -70,6 +70,14 @@ extern "C" {
 #define LPC2XXX_MODEL        2138          /*!< General model type of MCU    */
 #define __VIC_IRQ_SLOTS      16            /*!< # of IRQ slots in VIC        */
 
+/* The LPC213x/01 parts add the UARTs' fractional divider (FDR) and
+ *  auto-baud (ACR) registers, and the ADCs' INTEN, per-channel data and
+ *  STAT registers, all of which are reserved on the original
+ *  LPC2131/2/4/6/8.  Define LPC2XXX_PART_01 when building for a /01 part
+ *  to get them; otherwise only integer baud divisors are used and the ADC
+ *  is limited to CR / DR / GSR.
+ */
+
 
 /* IRQ Numbers ----------------------------------------------------------------------------------*/
 
@@ -98,7 +106,7 @@ typedef enum IRQn {
     ADC0_IRQn                = 0x12,   /*!< ADC 0 IRQ                        */
     I2C1_IRQn                = 0x13,   /*!< I2C 1 IRQ                        */
     BOD_IRQn                 = 0x14,   /*!< Brownout Detector IRQ            */
-    ADC1_IRQn                = 0x15,   /*!< ADC 0 IRQ                        */
+    ADC1_IRQn                = 0x15,   /*!< ADC 1 IRQ                        */
 } IRQn_Type;
 
 #define SPI1_IRQn       (SSP0_IRQn)    /*!< Referred to as SPI1 in datasheet */
@@ -191,7 +199,14 @@ typedef struct {
     __I     uint32_t    LSR;           /*!< Offset: 0x14 Line Status Register                 */
     __I     uint32_t    MSR;           /*!< Offset: 0x18 Modem Status Register                */
     __IO    uint32_t    SCR;           /*!< Offset: 0x1C Scratch Pad Register                 */
+#ifdef LPC2XXX_PART_01
+    __IO    uint32_t    ACR;           /*!< Offset: 0x20 Auto-baud Control Register (/01)     */
+            uint32_t      Reserved9;
+    __IO    uint32_t    FDR;           /*!< Offset: 0x28 Fractional Divider Register (/01)    */
+            uint32_t      Reserved11;
+#else
             uint32_t      Reserved8_11[4];
+#endif
     __IO    uint32_t    TER;           /*!< Offset: 0x30 Transmit Enable Register             */
 } UART_Type;
 
@@ -451,6 +466,11 @@ typedef struct {
     __IO    uint32_t    DR;            /*!< Offset: 0x04 Data Register                           */
 
     __O     uint32_t    GSR;           /*!< Offset: 0x08 Global Start Register (ADC0 Only)       */
+#ifdef LPC2XXX_PART_01
+    __IO    uint32_t    INTEN;         /*!< Offset: 0x0C Interrupt Enable Register (/01)         */
+    __I     uint32_t    CHDR[8];       /*!< Offset: 0x10 Channel Data Registers 0-7 (/01)        */
+    __I     uint32_t    STAT;          /*!< Offset: 0x30 Status Register (/01)                   */
+#endif
 } ADC_Type;
 
 /**
@@ -889,6 +909,10 @@ typedef struct {
   */
 
 #define LPC2XXX_HAS_UART
+#ifdef LPC2XXX_PART_01
+# define LPC2XXX_HAS_UART_FDR
+# define LPC2XXX_HAS_UART_AUTOBAUD
+#endif
 
 /** @defgroup UART_RBR_Bit_Definitions (UxRBR) UART Receive Buffer Register Bit Definitions
   *
@@ -937,7 +961,9 @@ typedef struct {
 #define UART_RBR_INT_ENA               (1 << 0)            /*!< Rx Data Avail/Timeout IRQ Enable */
 #define UART_THRE_INT_ENA              (1 << 1)            /*!< TX Holding Reg Empty IRQ Enable  */
 #define UART_LINE_INT_ENA              (1 << 2)            /*!< RX Line Status IRQ Enable        */
-#define UART_MODM_INT_ENA              (1 << 2)            /*!< RX Modem Status IRQ Enable       */
+#define UART_MODM_INT_ENA              (1 << 3)            /*!< RX Modem Status IRQ Enable       */
+#define UART_ABEO_INT_ENA              (1 << 8)            /*!< Auto Baud IRQ Enable             */
+#define UART_ABTO_INT_ENA              (1 << 9)            /*!< Auto Baud Timeout IRQ Enable     */
 
 /**
   * @}
@@ -963,6 +989,12 @@ typedef struct {
 #define UART_FIFO_Mask                 (0x03 << 6)         /*!< Copy of UFCR                     */
 #define UART_FIFO_Shift                (6)                 /*!< Bit Shift for Fifo Bits          */
 
+#define UART_ABIT_Mask                 (0x03 << 8)         /*!< Mask for Auto Baud Interrupts    */
+#define UART_ABIT_Shift                (8)
+
+#define UART_IT_ABEO                   (1 << 8)            /*!< End of Auto-Baud Interrupt       */
+#define UART_IT_ABTO                   (1 << 9)            /*!< Auto-Baud Timeout Interrupt      */
+
 /**
   * @}
   */
@@ -1079,6 +1111,41 @@ typedef struct {
 #define UART_RI                        (1 << 6)            /*!< Current RI State (inverted)      */
 #define UART_DCD                       (1 << 7)            /*!< Current DCD State (inverted)     */
 
+/**
+  * @}
+  */
+
+/** @defgroup UART_ACR_Bit_Definitions (UxACR) UART Auto-baud Control Register Bit Definitions
+  *
+  * @{
+  */
+
+#define UART_ACR_Mask                  (0x0307)            /*!< Useable Bits in UART ACR Reg.    */
+#define UART_ACR_Shift                 (0)
+
+#define UART_AUTOBAUD                  (1 << 0)            /*!< Autobaud Running                 */
+#define UART_MODE1                     (1 << 1)            /*!< Mode 1 Selected (0 = Mode 0)     */
+#define UART_AUTORESTART               (1 << 2)            /*!< Autobaud Restart on Timeout      */
+#define UART_ABEOIRQCLR                (1 << 8)            /*!< Clear ABEO Interrupt             */
+#define UART_ABTOIRQCLR                (1 << 9)            /*!< Clear ABTO Interrupt             */
+
+/**
+  * @}
+  */
+
+/** @defgroup UART_FDR_Bit_Definitions (UxFDR) UART Fractional Divider Register Bit Definitions
+  *
+  * @{
+  */
+
+#define UART_FDR_Mask                  (0xff)              /*!< Useable Bits in UART FDR Reg.    */
+#define UART_FDR_Shift                 (0)
+
+#define UART_DIVADDVAL_Mask            (0x0f)              /*!< Baud Rate Pre-Scaler Divisor     */
+#define UART_DIVADDVAL_Shift           (0)
+#define UART_MULVAL_Mask               (0x0f << 4)         /*!< Baud Rate Pre-Scaler Multiplier  */
+#define UART_MULVAL_Shift              (4)
+
 /**
   * @}
   */
@@ -2010,6 +2077,11 @@ typedef struct {
   */
 
 #define LPC2XXX_HAS_ADC
+#ifdef LPC2XXX_PART_01
+# define LPC2XXX_HAS_ADC_CHANNEL_REGS
+#endif
+#define LPC2XXX_HAS_ADC1
+#define LPC2XXX_HAS_ADC_GLOBAL_START
 
 /** @defgroup ADC_CR_Bit_Definitions (ADCxCR) ADC Control Register Bit Definitions
   *
@@ -2065,6 +2137,63 @@ typedef struct {
   * @}
   */
 
+/** @defgroup ADC_STAT_Bit_Definitions (ADCxSTAT) ADC Status Register Bit Definitions
+  *
+  * @{
+  */
+
+#define ADC_STAT_Mask                  (0x0001ffffUL)      /*!< Useable Bits in ADC STAT Reg.    */
+#define ADC_STAT_Shift                 (0)
+
+#define ADC_STATDONE_Mask              (0xffUL)            /*!< "DONE" Flags Mask                */
+#define ADC_STATDONE_Shift             (0)
+#define ADC_STATDONE_0                 (1UL << 0)          /*!< Channel 0 Done Flag              */
+#define ADC_STATDONE_1                 (1UL << 1)          /*!< Channel 1 Done Flag              */
+#define ADC_STATDONE_2                 (1UL << 2)          /*!< Channel 2 Done Flag              */
+#define ADC_STATDONE_3                 (1UL << 3)          /*!< Channel 3 Done Flag              */
+#define ADC_STATDONE_4                 (1UL << 4)          /*!< Channel 4 Done Flag              */
+#define ADC_STATDONE_5                 (1UL << 5)          /*!< Channel 5 Done Flag              */
+#define ADC_STATDONE_6                 (1UL << 6)          /*!< Channel 6 Done Flag              */
+#define ADC_STATDONE_7                 (1UL << 7)          /*!< Channel 7 Done Flag              */
+
+#define ADC_STATOVERRUN_Mask           (0xffUL << 8)       /*!< "OVERRUN" Flags Mask             */
+#define ADC_STATOVERRUN_Shift          (8)
+#define ADC_STATOVERRUN_0              (1UL << 8)          /*!< Channel 0 Overrun Flag           */
+#define ADC_STATOVERRUN_1              (1UL << 9)          /*!< Channel 1 Overrun Flag           */
+#define ADC_STATOVERRUN_2              (1UL << 10)         /*!< Channel 2 Overrun Flag           */
+#define ADC_STATOVERRUN_3              (1UL << 11)         /*!< Channel 3 Overrun Flag           */
+#define ADC_STATOVERRUN_4              (1UL << 12)         /*!< Channel 4 Overrun Flag           */
+#define ADC_STATOVERRUN_5              (1UL << 13)         /*!< Channel 5 Overrun Flag           */
+#define ADC_STATOVERRUN_6              (1UL << 14)         /*!< Channel 6 Overrun Flag           */
+#define ADC_STATOVERRUN_7              (1UL << 15)         /*!< Channel 7 Overrun Flag           */
+
+#define ADC_ADINT                      (1UL << 16)         /*!< Interrupt Flag                   */
+
+/**
+  * @}
+  */
+
+/** @defgroup ADC_INTEN_Bit_Definitions (ADCxINTEN) ADC Interrupt Enable Register Bit Definitions
+  *
+  * @{
+  */
+
+#define ADC_INTEN_Mask                 (0x01ff)            /*!< Useable Bits in ADC INTEN Reg    */
+#define ADC_INTEN_Shift                (0)
+
+#define ADC_ADINTEN_Mask               (0xff)              /*!< Enable Channel Interrupts Mask   */
+#define ADC_ADINTEN_Shift              (0)
+#define ADC_ADINTEN_0                  (1 << 0)            /*!< Enable Interrupt on Channel 0    */
+#define ADC_ADINTEN_1                  (1 << 1)            /*!< Enable Interrupt on Channel 1    */
+#define ADC_ADINTEN_2                  (1 << 2)            /*!< Enable Interrupt on Channel 2    */
+#define ADC_ADINTEN_3                  (1 << 3)            /*!< Enable Interrupt on Channel 3    */
+#define ADC_ADINTEN_4                  (1 << 4)            /*!< Enable Interrupt on Channel 4    */
+#define ADC_ADINTEN_5                  (1 << 5)            /*!< Enable Interrupt on Channel 5    */
+#define ADC_ADINTEN_6                  (1 << 6)            /*!< Enable Interrupt on Channel 6    */
+#define ADC_ADINTEN_7                  (1 << 7)            /*!< Enable Interrupt on Channel 7    */
+
+#define ADC_ADGINTEN                   (1 << 8)            /*!< Enable ADC Global Interrupt      */
+
 /** @defgroup ADC_GSR_Bit_Definitions (ADGSR) ADC Global Start Register Bit Definitions
   *
   * @{
@@ -101,6 +101,37 @@ extern "C" {
   * @}
   */
 
+/** @addtogroup ADC_Results
+  * @{
+  */
+#define ADC_MAX_CLOCK (4500000UL)     /*!< Fastest ADC clock allowed (Hz)        */
+#define ADC_CONVERSION_CLOCKS (11)    /*!< ADC clocks per (10 bit) conversion    */
+#define ADC_RESULT_Mask (0xffc0)      /*!< Result bits (left-justified) in a DR  */
+
+/*! @brief Get the left-justified conversion result from a data register value */
+#define ADC_RESULT(DR)  ((uint16_t)((DR) & ADC_RESULT_Mask))
+
+/*! @brief Get the channel number from a (global) data register value */
+#define ADC_CHANNEL(DR) ((uint8_t)(((DR) & ADC_CHN_Mask) >> ADC_CHN_Shift))
+
+/**
+  * @}
+  */
+
+#ifdef LPC2XXX_HAS_ADC_CHANNEL_REGS
+
+/** @addtogroup ADC_Channel_Status (from ADC_ReadChannel)
+  * @{
+  */
+#define ADC_ChannelStatus_Done    (1 << 0)  /*!< A new result was read          */
+#define ADC_ChannelStatus_Overrun (1 << 1)  /*!< A result was overwritten first */
+
+/**
+  * @}
+  */
+
+#endif /* #ifdef LPC2XXX_HAS_ADC_CHANNEL_REGS */
+
 /** @addtogroup ADC_Burst_Resolutions (need to be shifted to match register settings)
   * @{
   */
@@ -219,7 +250,7 @@ __INLINE static uint16_t ADC_GetChannelMask(ADC_Type *ADC)
 __INLINE static void ADC_EnableChannel(ADC_Type *ADC, uint8_t Channel)
 {
    /* Make sure only 1 channel selected */
-   lpc2xxx_lib_assert(Input <= 7);
+   lpc2xxx_lib_assert(Channel <= 7);
 
     ADC->CR |= (1 << (Channel + ADC_SEL_Shift));
 }
@@ -231,7 +262,7 @@ __INLINE static void ADC_EnableChannel(ADC_Type *ADC, uint8_t Channel)
 __INLINE static void ADC_DisableChannel(ADC_Type *ADC, uint8_t Channel)
 {
    /* Make sure only 1 channel selected */
-   lpc2xxx_lib_assert(Input <= 7);
+   lpc2xxx_lib_assert(Channel <= 7);
 
     ADC->CR &= ~(1 << (Channel + ADC_SEL_Shift));
 }
@@ -245,6 +276,32 @@ __INLINE static uint8_t ADC_ChannelIsEnabled(ADC_Type *ADC, uint8_t Channel)
     return (ADC->CR & (1 << (Channel + ADC_SEL_Shift))) ? 1:0;
 }
 
+/** @brief Calculate the ADC Clock Divider for a Target ADC Clock
+  * @param  PClk        The ADC's peripheral (APB) clock, in Hz
+  * @param  Hz          Fastest ADC clock wanted (limited to ADC_MAX_CLOCK)
+  * @return The smallest divider (1 - 256) that keeps the ADC clock at or
+  *          below Hz, or 0 if even 256 doesn't.  ADC_SetClockDivisor()
+  *          takes this minus 1.
+  */
+__INLINE static uint32_t ADC_CalcClockDivider(uint32_t PClk, uint32_t Hz)
+{
+    uint32_t Div;
+
+
+    lpc2xxx_lib_assert(Hz != 0);
+
+    if (Hz > ADC_MAX_CLOCK) {
+        Hz = ADC_MAX_CLOCK;
+    }
+
+    Div = (PClk + Hz - 1) / Hz;
+    if (Div == 0) {
+        return 1;
+    }
+
+    return (Div > 256) ? 0 : Div;
+}
+
 /** @brief Set the ADC Clock Divisor.  End clock rate should be <= 4.5Mhz
   * @param  ADC         The A to D Converter
   * @param  Divisor  The divisor by which to divide the clock
@@ -397,6 +454,74 @@ __INLINE static uint8_t ADC_IsBusy(ADC_Type *ADC)
     return !(ADC->DR & ADC_DONE);
 }
 
+#ifdef LPC2XXX_HAS_ADC_CHANNEL_REGS
+
+/** @brief Read an ADC Channel's Own Data Register
+  * @param  ADC         The A to D Converter
+  * @param  Channel     Channel # to read
+  * @param  Value       Where to put the result (as ADC_RESULT())
+  * @return ADC_ChannelStatus_* flags (Value is only set if Done)
+  *
+  * Reading the register clears the channel's DONE and OVERRUN flags.
+  */
+__INLINE static uint8_t ADC_ReadChannel(ADC_Type *ADC, uint8_t Channel, uint16_t *Value)
+{
+    uint32_t DR;
+
+
+    lpc2xxx_lib_assert(Channel <= 7);
+
+    DR = ADC->CHDR[Channel];
+    if (!(DR & ADC_DONE)) {
+        return 0;
+    }
+
+    *Value = ADC_RESULT(DR);
+
+    return (DR & ADC_OVERRUN) ? (ADC_ChannelStatus_Done | ADC_ChannelStatus_Overrun)
+                              : ADC_ChannelStatus_Done;
+}
+
+/** @brief Read Every Channel With a New Result
+  * @param  ADC         The A to D Converter
+  * @param  Values      8 results, by channel; only the done channels are set
+  * @return The status: done channels in bits 0-7, overwritten channels in
+  *          bits 8-15 (ADC_STATDONE_* / ADC_STATOVERRUN_*)
+  *
+  * One status read, then one data register read per done channel, which
+  *  clears its flags.
+  */
+__INLINE static uint16_t ADC_ReadAllChannels(ADC_Type *ADC, uint16_t Values[8])
+{
+    uint32_t Stat = ADC->STAT;
+    uint32_t Done = Stat & ADC_STATDONE_Mask;
+    uint8_t  Channel;
+
+
+    for (Channel = 0; Done; Channel++, Done >>= 1) {
+        if (Done & 1) {
+            Values[Channel] = ADC_RESULT(ADC->CHDR[Channel]);
+        }
+    }
+
+    return Stat & (ADC_STATDONE_Mask | ADC_STATOVERRUN_Mask);
+}
+
+/** @brief Set Which Conversions Interrupt
+  * @param  ADC         The A to D Converter
+  * @param  Mask        ADC_ADINTEN_* for a channel's conversion, ADC_ADGINTEN
+  *                      for any (the reset setting)
+  * @return None.
+  */
+__INLINE static void ADC_SetInterruptMask(ADC_Type *ADC, uint16_t Mask)
+{
+    lpc2xxx_lib_assert((Mask & ~ADC_INTEN_Mask) == 0);
+
+    ADC->INTEN = Mask;
+}
+
+#endif /* #ifdef LPC2XXX_HAS_ADC_CHANNEL_REGS */
+
 /**
   * @}
   */
@@ -0,0 +1,250 @@
+/******************************************************************************
+ * @file:    LPC2xxx_adc_burst.h
+ * @purpose: Header File for Interrupt-Driven ADC Burst Mode Acquisition
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - The ADC scans the selected channels in burst mode and interrupts on
+ *   each conversion.  The ISR sorts each result by the channel number in
+ *   the data register into that channel's ring, so no sample is lost to the
+ *   next channel's result as it would be when polling ADC_Read().
+ *
+ * - The scan rate is set by the ADC clock: each channel is sampled at
+ *   Clock / (11 - Resolution) / (number of channels) Hz.  Every conversion
+ *   is an interrupt, so keep the total rate within what the ISR can keep
+ *   up with; lost conversions are counted as hardware overruns.
+ *
+ * - Samples are stored as by ADC_RESULT(): left-justified in 16 bits.
+ *
+ * - Pin / power setup and the VIC routing are left to the application.
+ *   Its ADC IRQ handler should call ADCBurst_IRQHandler() and then
+ *   VIC_IRQDone().
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_ADC_BURST_H_
+#define LPC2XXX_ADC_BURST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_adc.h"
+
+
+/** @addtogroup ADCBurst ADC Burst Mode Acquisition
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup ADCBurst_Defines
+  * @{
+  */
+
+/*! @brief Check that a ring size is a non-zero power of two <= 32768 */
+#define ADCBURST_IS_RING_SIZE(Size) (((Size) != 0) && ((Size) <= 32768) \
+                                  && (((Size) & ((Size) - 1)) == 0))
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup ADCBurst_Types
+  * @{
+  */
+
+/*! @brief Sample ring for one channel.
+  *
+  * Head / Tail run freely and are masked on access; the ISR only writes
+  *  Head and the application only writes Tail.
+  */
+typedef struct {
+    uint16_t              *Buf;          /*!< Ring storage (NULL = discard)  */
+    uint16_t               Mask;         /*!< Ring size - 1                  */
+    volatile uint16_t      Head;         /*!< Next slot to fill (ISR)        */
+    volatile uint16_t      Tail;         /*!< Next slot to read (application)*/
+    volatile uint32_t      Dropped;      /*!< Samples lost: ring was full    */
+} ADCBurst_Ring_Type;
+
+/*! @brief State for one burst mode acquisition */
+typedef struct {
+    ADC_Type              *ADC;          /*!< The A to D converter           */
+    ADCBurst_Ring_Type     Ring[8];      /*!< Per-channel sample rings       */
+    volatile uint32_t      Overruns;     /*!< Conversions lost before the ISR
+                                              got to them                    */
+} ADCBurst_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup ADCBurst_Functions ADC Burst Mode Exported Functions
+  * @{
+  */
+
+/** @brief  Set up burst mode acquisition on an ADC (not started)
+  *
+  * @param  [out] B        Acquisition state to initialize
+  * @param  [in]  ADC      The A to D converter
+  *
+  * @return None.
+  *
+  * All channels start out with no ring; see ADCBurst_SetRing().
+  */
+void ADCBurst_Init(ADCBurst_Type *B, ADC_Type *ADC);
+
+/** @brief  Give a channel a sample ring
+  *
+  * @param  [in]  B        Acquisition state
+  * @param  [in]  Channel  Channel number (0 - 7)
+  * @param  [in]  Buf      Ring storage
+  * @param  [in]  Size     Number of samples in Buf (power of 2)
+  *
+  * @return None.
+  *
+  * Must be called while stopped.
+  */
+void ADCBurst_SetRing(ADCBurst_Type *B, uint8_t Channel, uint16_t *Buf, uint16_t Size);
+
+/** @brief  Start scanning a set of channels
+  *
+  * @param  [in]  B            Acquisition state
+  * @param  [in]  ChannelMask  Channels to scan (ADC_ChannelMask_*)
+  * @param  [in]  Clock        ADC clock to aim for (Hz, <= ADC_MAX_CLOCK)
+  * @param  [in]  Resolution   Bits per conversion
+  *
+  * @return The ADC clock actually used (Hz); never above Clock.  0 (and
+  *          nothing started) if PCLK / 256 is still above Clock.
+  *
+  * The ADC's VIC slot should already be set up.  Rings are emptied.
+  */
+uint32_t ADCBurst_Start(ADCBurst_Type *B, uint16_t ChannelMask, uint32_t Clock,
+                        ADC_BurstResolution_Type Resolution);
+
+/** @brief  Stop scanning
+  *
+  * @param  [in]  B        Acquisition state
+  *
+  * @return None.
+  *
+  * Samples already in the rings can still be read.
+  */
+void ADCBurst_Stop(ADCBurst_Type *B);
+
+/** @brief  Retrieve samples for one channel
+  *
+  * @param  [in]  B        Acquisition state
+  * @param  [in]  Channel  Channel number (0 - 7)
+  * @param  [out] Data     Where to store samples
+  * @param  [in]  Len      Maximum number of samples to retrieve
+  *
+  * @return Number of samples retrieved (0 if none were waiting).
+  */
+uint16_t ADCBurst_Read(ADCBurst_Type *B, uint8_t Channel, uint16_t *Data, uint16_t Len);
+
+/** @brief  Service an ADC interrupt
+  *
+  * @param  [in]  B        Acquisition state for the interrupting ADC
+  *
+  * @return None.
+  *
+  * Does NOT acknowledge the VIC.
+  */
+void ADCBurst_IRQHandler(ADCBurst_Type *B);
+
+/**
+  * @}
+  */
+
+
+/* Inline Functions ---------------------------------------------------------*/
+
+/** @defgroup ADCBurst_Inline_Functions
+  * @{
+  */
+
+/** @brief  Get the Number of Samples Waiting for a Channel
+  * @param  B       Acquisition state
+  * @param  Channel Channel number (0 - 7)
+  * @return Number of samples that can be read
+  */
+__INLINE static uint16_t ADCBurst_Available(ADCBurst_Type *B, uint8_t Channel)
+{
+    return (uint16_t)(B->Ring[Channel].Head - B->Ring[Channel].Tail);
+}
+
+/** @brief  Get the Number of Samples Dropped for a Channel Because its Ring Was Full
+  * @param  B       Acquisition state
+  * @param  Channel Channel number (0 - 7)
+  * @return Samples dropped since started
+  */
+__INLINE static uint32_t ADCBurst_GetDropped(ADCBurst_Type *B, uint8_t Channel)
+{
+    return B->Ring[Channel].Dropped;
+}
+
+/** @brief  Get the Number of Conversions Overwritten Before They Were Read
+  * @param  B       Acquisition state
+  * @return Hardware overruns since started
+  */
+__INLINE static uint32_t ADCBurst_GetOverruns(ADCBurst_Type *B)
+{
+    return B->Overruns;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_ADC_BURST_H_ */
@@ -0,0 +1,232 @@
+/******************************************************************************
+ * @file:    LPC2xxx_adc_dual.h
+ * @purpose: Header File for Simultaneous Sampling on ADC0 and ADC1
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - One channel on each converter (e.g. voltage on ADC0, current on ADC1)
+ *   is started by the same timer match edge, through the global start
+ *   register where there is one, and the two results are stored as a
+ *   pair: a single interleaved stream of ADC0, ADC1, ADC0, ADC1...
+ *
+ * - Both converters run from the same PCLK and divider, but each divides
+ *   it down on its own, so the two sampling instants can still be up to
+ *   an ADC clock apart.  ADCDual_MeasureSkew() measures what it actually is.
+ *
+ * - Only ADC1 interrupts; the application's ADC1 IRQ handler should call
+ *   ADCDual_IRQHandler() and then VIC_IRQDone().  ADC0's IRQ must stay
+ *   disabled in the VIC: parts without the INTEN register (LPC213x other
+ *   than /01) can't mask it at the ADC.  Pin / power setup and the VIC
+ *   routing are left to the application.
+ *
+ * - Pacing uses the timers the same way as LPC2xxx_adc_timed.h.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_ADC_DUAL_H_
+#define LPC2XXX_ADC_DUAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_adc.h"
+#include "LPC2xxx_adc_timed.h"
+
+#ifndef LPC2XXX_HAS_ADC1
+#error  Your CPU does not seem to have two ADCs, or a CPU header file is missing/incorrect.
+#endif
+
+
+/** @addtogroup ADCDual Simultaneous Dual ADC Sampling
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup ADCDual_Defines
+  * @{
+  */
+
+/*! @brief Check that a ring size (in pairs) is a non-zero power of two <= 32768 */
+#define ADCDUAL_IS_RING_SIZE(Size) (((Size) != 0) && ((Size) <= 32768) \
+                                 && (((Size) & ((Size) - 1)) == 0))
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup ADCDual_Types
+  * @{
+  */
+
+/*! @brief State for simultaneous sampling on ADC0 / ADC1.
+  *
+  * Head / Tail count pairs, run freely and are masked on access; the ISR
+  *  only writes Head and the application only writes Tail.
+  */
+typedef struct {
+    ADCTimed_Timer_Type     *Timer;       /*!< Timer pacing both ADCs        */
+
+    uint16_t                *Ring;        /*!< Pairs, ADC0 result first      */
+    uint16_t                 Mask;        /*!< Ring size (pairs) - 1         */
+    volatile uint16_t        Head;        /*!< Next pair to fill (ISR)       */
+    volatile uint16_t        Tail;        /*!< Next pair to read (app)       */
+
+    volatile uint32_t        Dropped;     /*!< Pairs lost: ring was full     */
+    volatile uint32_t        Overruns;    /*!< Pairs where a result was
+                                               overwritten before being read */
+    volatile uint32_t        Unpaired;    /*!< ADC1 results ADC0 didn't match */
+} ADCDual_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup ADCDual_Functions Dual ADC Exported Functions
+  * @{
+  */
+
+/** @brief  Start sampling a channel on each ADC together at a fixed rate
+  *
+  * @param  [out] D         Dual sampling state to initialize
+  * @param  [in]  Channel0  Channel to sample on ADC0 (0 - 7)
+  * @param  [in]  Channel1  Channel to sample on ADC1 (0 - 7)
+  * @param  [in]  Trigger   Timer match to start conversions from
+  *                          (ADC_Start_TIMERx_MATy_*)
+  * @param  [in]  Rate      Pairs per second
+  * @param  [in]  Ring      Ring storage, 2 * Pairs results
+  * @param  [in]  Pairs     Ring size in pairs (power of 2)
+  *
+  * @return The sample rate set up, in mHz, or 0 if Rate is out of reach.
+  *
+  * ADC1's VIC slot should already be set up.
+  */
+uint32_t ADCDual_Start(ADCDual_Type *D, uint8_t Channel0, uint8_t Channel1,
+                       ADC_Start_Type Trigger, uint32_t Rate,
+                       uint16_t *Ring, uint16_t Pairs);
+
+/** @brief  Stop sampling
+  *
+  * @param  [in]  D         Dual sampling state
+  *
+  * @return None.
+  */
+void ADCDual_Stop(ADCDual_Type *D);
+
+/** @brief  Retrieve sample pairs
+  *
+  * @param  [in]  D         Dual sampling state
+  * @param  [out] Data      Where to store the pairs (ADC0, ADC1, ADC0, ...)
+  * @param  [in]  Pairs     Maximum number of pairs to retrieve
+  *
+  * @return Number of pairs retrieved (0 if none were waiting).
+  */
+uint16_t ADCDual_Read(ADCDual_Type *D, uint16_t *Data, uint16_t Pairs);
+
+/** @brief  Service ADC1's interrupt
+  *
+  * @param  [in]  D         Dual sampling state
+  *
+  * @return None.
+  *
+  * Does NOT acknowledge the VIC.
+  */
+void ADCDual_IRQHandler(ADCDual_Type *D);
+
+/** @brief  Measure how far apart the two ADCs convert
+  *
+  * @param  [in]  Channel0  Channel to convert on ADC0 (0 - 7)
+  * @param  [in]  Channel1  Channel to convert on ADC1 (0 - 7)
+  * @param  [in]  Clock     A free-running timer to time with, counting PCLKs
+  *                          (prescaler 0)
+  * @param  [in]  Trials    Number of pairs to time (at least 1)
+  *
+  * @return The average time from ADC0's result to ADC1's, in PCLKs
+  *          (negative if ADC1 finishes first; 0 if PCLK can't be divided
+  *          down to ADC_MAX_CLOCK).
+  *
+  * Starts both ADCs together Trials times (the same way ADCDual_Start()
+  *  does) and polls for the results, so it's good to within a poll loop;
+  *  a few PCLKs.  Both ADCs' interrupts are masked while it runs where
+  *  there's an INTEN register; elsewhere ADC1's IRQ has to be disabled in
+  *  the VIC first.  Not to be used while sampling.
+  */
+int32_t ADCDual_MeasureSkew(uint8_t Channel0, uint8_t Channel1,
+                            ADCTimed_Timer_Type *Clock, uint8_t Trials);
+
+/**
+  * @}
+  */
+
+
+/* Inline Functions ---------------------------------------------------------*/
+
+/** @defgroup ADCDual_Inline_Functions
+  * @{
+  */
+
+/** @brief  Get the Number of Sample Pairs Waiting
+  * @param  D       Dual sampling state
+  * @return Number of pairs that can be read
+  */
+__INLINE static uint16_t ADCDual_Available(ADCDual_Type *D)
+{
+    return (uint16_t)(D->Head - D->Tail);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_ADC_DUAL_H_ */
@@ -0,0 +1,234 @@
+/******************************************************************************
+ * @file:    LPC2xxx_adc_timed.h
+ * @purpose: Header File for Timer-Paced ADC Sampling
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - A timer match toggles its external match bit every half sample period
+ *   and the ADC starts a conversion on each rising (or falling) edge, so
+ *   the sample clock is pure hardware; ISR latency only affects when a
+ *   result is picked up, never when it was taken.
+ *
+ * - The timer is TIMER0 / TIMER1 (CT32B0 / CT32B1 on parts that call them
+ *   that), picked by the ADC start source, and is given over entirely to
+ *   pacing.  The match pin doesn't need to be routed out.
+ *
+ * - The rate is exact when PCLK is a multiple of twice the rate (e.g.
+ *   8kHz from 60MHz); otherwise it's the nearest the timer can do, which
+ *   ADCTimed_Start() returns.
+ *
+ * - Results fill two buffers in turn; as each fills, the callback is
+ *   handed it from the ISR and has until the other fills to use it.
+ *
+ * - Pin / power setup and the VIC routing are left to the application.
+ *   Its ADC IRQ handler should call ADCTimed_IRQHandler() and then
+ *   VIC_IRQDone().
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_ADC_TIMED_H_
+#define LPC2XXX_ADC_TIMED_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_adc.h"
+
+#if defined(LPC2XXX_HAS_TIMER)
+# include "LPC2xxx_timer.h"
+#elif defined(LPC2XXX_HAS_CT32B)
+# include "LPC2xxx_ct32b.h"
+#else
+# error  Your CPU does not seem to have a 32-Bit Timer, or a CPU header file is missing/incorrect.
+#endif
+
+
+/** @addtogroup ADCTimed Timer-Paced ADC Sampling
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup ADCTimed_Defines
+  * @{
+  */
+
+/*! @brief Check whether a sample rate can be hit exactly from a PCLK */
+#define ADCTIMED_IS_EXACT(PClk, Rate) (((PClk) % (2 * (Rate))) == 0)
+
+/*! @brief Check that a start source is a timer match */
+#define ADCTIMED_IS_TRIGGER(Start) (ADC_IS_START(Start)                      \
+                                 && (((Start) & 0x07) != ADC_Start_None)     \
+                                 && (((Start) & 0x07) != ADC_Start_Now))
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup ADCTimed_Types
+  * @{
+  */
+
+#if defined(LPC2XXX_HAS_TIMER)
+typedef TIMER_Type ADCTimed_Timer_Type;  /*!< Timers the ADC can start from  */
+#else
+typedef CT32B_Type ADCTimed_Timer_Type;  /*!< Timers the ADC can start from  */
+#endif
+
+/*! @brief Buffer full callback; called from the ADC's ISR */
+typedef void (*ADCTimed_Callback_Type)(void *Arg, uint16_t *Samples, uint16_t Len);
+
+/*! @brief State for one timer-paced ADC */
+typedef struct {
+    ADC_Type                *ADC;         /*!< The A to D converter          */
+    ADCTimed_Timer_Type     *Timer;       /*!< Timer pacing it               */
+
+    uint16_t                *Buf[2];      /*!< Sample buffers, used in turn  */
+    uint16_t                 Len;         /*!< Samples per buffer            */
+    uint16_t                 Pos;         /*!< Next sample in current buffer */
+    uint8_t                  Fill;        /*!< Buffer being filled           */
+    ADCTimed_Callback_Type   Done;        /*!< Called as each buffer fills   */
+    void                    *Arg;         /*!< Passed to Done                */
+
+    volatile uint32_t        Blocks;      /*!< Buffers filled                */
+    volatile uint32_t        Overruns;    /*!< Conversions lost before the ISR
+                                               got to them                   */
+} ADCTimed_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup ADCTimed_Functions Timer-Paced ADC Exported Functions
+  * @{
+  */
+
+/** @brief  Set up the timer behind an ADC start source to pace conversions
+  *
+  * @param  [in]  Trigger  Timer match start source (ADC_Start_TIMERx_MATy_*)
+  * @param  [in]  Rate     Conversions per second
+  * @param  [out] Timer    Where to put the timer that was set up
+  *
+  * @return The rate set up, in mHz, or 0 if Rate is too fast for the timer.
+  *
+  * For pacing conversions set up by hand (e.g. LPC2xxx_adc_dual.h); the
+  *  timer is left stopped and held in reset until ADCTimed_StartPacer().
+  */
+uint32_t ADCTimed_SetupPacer(ADC_Start_Type Trigger, uint32_t Rate, ADCTimed_Timer_Type **Timer);
+
+/** @brief  Let a pacing timer run
+  *
+  * @param  [in]  Timer    Timer from ADCTimed_SetupPacer()
+  *
+  * @return None.
+  */
+void ADCTimed_StartPacer(ADCTimed_Timer_Type *Timer);
+
+/** @brief  Stop a pacing timer
+  *
+  * @param  [in]  Timer    Timer from ADCTimed_SetupPacer()
+  *
+  * @return None.
+  */
+void ADCTimed_StopPacer(ADCTimed_Timer_Type *Timer);
+
+/** @brief  Start sampling one channel at a fixed rate
+  *
+  * @param  [out] T        Sampling state to initialize
+  * @param  [in]  ADC      The A to D converter
+  * @param  [in]  Channel  Channel to sample (0 - 7)
+  * @param  [in]  Trigger  Timer match to start conversions from
+  *                         (ADC_Start_TIMERx_MATy_*)
+  * @param  [in]  Rate     Samples per second
+  * @param  [in]  BufA     First sample buffer
+  * @param  [in]  BufB     Second sample buffer (NULL = reuse BufA)
+  * @param  [in]  Len      Samples per buffer
+  * @param  [in]  Done     Called (from the ISR) with each full buffer; may
+  *                         be NULL
+  * @param  [in]  Arg      Passed to Done
+  *
+  * @return The sample rate set up, in mHz, or 0 if Rate is out of reach
+  *          (faster than a conversion, or too slow for the timer).
+  *
+  * The ADC's VIC slot should already be set up.  The ADC clock is set as
+  *  fast as allowed.
+  */
+uint32_t ADCTimed_Start(ADCTimed_Type *T, ADC_Type *ADC, uint8_t Channel,
+                        ADC_Start_Type Trigger, uint32_t Rate,
+                        uint16_t *BufA, uint16_t *BufB, uint16_t Len,
+                        ADCTimed_Callback_Type Done, void *Arg);
+
+/** @brief  Stop sampling
+  *
+  * @param  [in]  T        Sampling state
+  *
+  * @return None.
+  */
+void ADCTimed_Stop(ADCTimed_Type *T);
+
+/** @brief  Service an ADC interrupt
+  *
+  * @param  [in]  T        Sampling state for the interrupting ADC
+  *
+  * @return None.
+  *
+  * Does NOT acknowledge the VIC.
+  */
+void ADCTimed_IRQHandler(ADCTimed_Type *T);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_ADC_TIMED_H_ */
@@ -0,0 +1,251 @@
+/******************************************************************************
+ * @file:    LPC2xxx_decimate.h
+ * @purpose: Header File for Fixed-Point CIC / FIR Decimation Filters
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - Meant for oversampled ADC data: a CIC decimator takes blocks of raw ADC
+ *   results (as from ADC_RESULT(), e.g. the buffers LPC2xxx_adc_timed.h
+ *   hands out) where they lie, and puts out Q31.  A block FIR (Q15 or Q31,
+ *   optionally decimating again) then cleans up the CIC's droop and
+ *   aliasing.
+ *
+ * - The FIR inner loops are unrolled by 4 with 64 bit accumulators, which
+ *   gcc turns into SMLAL on the ARM7TDMI.  They're always built as ARM code
+ *   (gcc 6 and later), even in a Thumb build.
+ *
+ * - Build with -DDECIMATE_IN_RAM to put the filter loops in .fastcode,
+ *   which the link scripts copy to RAM, to run them without flash wait
+ *   states.
+ *
+ * - Filter state is per stream; nothing here is interrupt or thread aware.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_DECIMATE_H_
+#define LPC2XXX_DECIMATE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+
+
+/** @addtogroup Decimate Fixed-Point Decimation Filters
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup Decimate_Defines
+  * @{
+  */
+
+#define DECIMATE_CIC_MAX_ORDER  (4)   /*!< Most CIC integrator / comb stages */
+
+/*! @brief Check CIC parameters (Decimate_CICInit() checks the growth) */
+#define DECIMATE_IS_CIC(Order, Ratio) (((Order) >= 1)                        \
+                                    && ((Order) <= DECIMATE_CIC_MAX_ORDER)   \
+                                    && ((Ratio) >= 1))
+
+/*! @brief Convert a raw ADC result (ADC_RESULT()) to Q15 about mid-scale */
+#define DECIMATE_ADC_TO_Q15(Result) ((int16_t)((Result) ^ 0x8000))
+
+/*! @brief Function attributes for the filter loops */
+#if defined(__GNUC__) && (__GNUC__ >= 6) && defined(__arm__)
+# define DECIMATE_ARM_CODE      __attribute__((target("arm")))
+#else
+# define DECIMATE_ARM_CODE
+#endif
+
+#ifdef DECIMATE_IN_RAM
+# define DECIMATE_FASTCODE      DECIMATE_ARM_CODE __attribute__((section(".fastcode")))
+#else
+# define DECIMATE_FASTCODE      DECIMATE_ARM_CODE
+#endif
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup Decimate_Types
+  * @{
+  */
+
+/*! @brief CIC decimator state (differential delay of 1).
+  *
+  * Integrators and combs wrap modulo 2^32, which is harmless as long as
+  *  the output fits; that's what limits the growth to 16 bits.
+  */
+typedef struct {
+    uint8_t     Order;                        /*!< Number of stages          */
+    uint8_t     Shift;                        /*!< Left shift to Q31         */
+    uint16_t    Ratio;                        /*!< Decimation ratio          */
+    uint16_t    Phase;                        /*!< Inputs since last output  */
+    uint32_t    Integ[DECIMATE_CIC_MAX_ORDER]; /*!< Integrator states        */
+    uint32_t    Comb[DECIMATE_CIC_MAX_ORDER];  /*!< Comb delay states        */
+} Decimate_CIC_Type;
+
+/*! @brief Q15 FIR state.
+  *
+  * The delay line is kept twice over (State[Pos + k] == State[Pos + k +
+  *  NumTaps]) so the newest NumTaps samples are always contiguous.
+  */
+typedef struct {
+    const int16_t *Coeffs;                    /*!< Taps, Q15                 */
+    int16_t       *State;                     /*!< Delay line, 2 * NumTaps   */
+    uint16_t       NumTaps;                   /*!< Number of taps            */
+    uint16_t       Pos;                       /*!< Newest sample in State    */
+    uint16_t       Ratio;                     /*!< Decimation ratio (1: none)*/
+    uint16_t       Phase;                     /*!< Inputs since last output  */
+} Decimate_FIRQ15_Type;
+
+/*! @brief Q31 FIR state (see Decimate_FIRQ15_Type) */
+typedef struct {
+    const int32_t *Coeffs;                    /*!< Taps, Q31                 */
+    int32_t       *State;                     /*!< Delay line, 2 * NumTaps   */
+    uint16_t       NumTaps;                   /*!< Number of taps            */
+    uint16_t       Pos;                       /*!< Newest sample in State    */
+    uint16_t       Ratio;                     /*!< Decimation ratio (1: none)*/
+    uint16_t       Phase;                     /*!< Inputs since last output  */
+} Decimate_FIRQ31_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup Decimate_Functions Decimation Filter Exported Functions
+  * @{
+  */
+
+/** @brief  Set up a CIC decimator
+  *
+  * @param  [out] C        CIC state to initialize
+  * @param  [in]  Order    Number of integrator / comb stages (1 - 4)
+  * @param  [in]  Ratio    Decimation ratio
+  *
+  * @return None.
+  *
+  * Ratio ^ Order may be at most 65536.  The output is normalized to unity
+  *  DC gain when Ratio is a power of 2; otherwise the gain is
+  *  Ratio ^ Order / (the next power of 2 up).
+  */
+void Decimate_CICInit(Decimate_CIC_Type *C, uint8_t Order, uint16_t Ratio);
+
+/** @brief  Run raw ADC results through a CIC decimator
+  *
+  * @param  [in]  C        CIC state
+  * @param  [in]  In       ADC results (as ADC_RESULT())
+  * @param  [in]  Len      Number of results
+  * @param  [out] Out      Where to put the output, Q31; room for
+  *                         Len / Ratio + 1 samples
+  *
+  * @return Number of output samples.
+  */
+uint16_t Decimate_CIC(Decimate_CIC_Type *C, const uint16_t *In, uint16_t Len, int32_t *Out);
+
+/** @brief  Set up a Q15 FIR filter
+  *
+  * @param  [out] F        FIR state to initialize
+  * @param  [in]  Coeffs   Taps, Q15 (kept, not copied)
+  * @param  [in]  NumTaps  Number of taps
+  * @param  [in]  Ratio    Decimation ratio (1 for plain filtering)
+  * @param  [in]  State    Delay line storage, 2 * NumTaps samples
+  *
+  * @return None.
+  */
+void Decimate_FIRQ15Init(Decimate_FIRQ15_Type *F, const int16_t *Coeffs, uint16_t NumTaps,
+                         uint16_t Ratio, int16_t *State);
+
+/** @brief  Run a block of samples through a Q15 FIR filter
+  *
+  * @param  [in]  F        FIR state
+  * @param  [in]  In       Input samples, Q15
+  * @param  [in]  Len      Number of input samples
+  * @param  [out] Out      Where to put the output, Q15 (rounded and
+  *                         saturated); may be In
+  *
+  * @return Number of output samples.
+  */
+uint16_t Decimate_FIRQ15(Decimate_FIRQ15_Type *F, const int16_t *In, uint16_t Len, int16_t *Out);
+
+/** @brief  Set up a Q31 FIR filter
+  *
+  * @param  [out] F        FIR state to initialize
+  * @param  [in]  Coeffs   Taps, Q31 (kept, not copied)
+  * @param  [in]  NumTaps  Number of taps
+  * @param  [in]  Ratio    Decimation ratio (1 for plain filtering)
+  * @param  [in]  State    Delay line storage, 2 * NumTaps samples
+  *
+  * @return None.
+  */
+void Decimate_FIRQ31Init(Decimate_FIRQ31_Type *F, const int32_t *Coeffs, uint16_t NumTaps,
+                         uint16_t Ratio, int32_t *State);
+
+/** @brief  Run a block of samples through a Q31 FIR filter
+  *
+  * @param  [in]  F        FIR state
+  * @param  [in]  In       Input samples, Q31
+  * @param  [in]  Len      Number of input samples
+  * @param  [out] Out      Where to put the output, Q31 (rounded and
+  *                         saturated); may be In
+  *
+  * @return Number of output samples.
+  */
+uint16_t Decimate_FIRQ31(Decimate_FIRQ31_Type *F, const int32_t *In, uint16_t Len, int32_t *Out);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_DECIMATE_H_ */
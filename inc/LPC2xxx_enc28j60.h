@@ -0,0 +1,229 @@
+/******************************************************************************
+ * @file:    LPC2xxx_enc28j60.h
+ * @purpose: Header File for ENC28J60 SPI Ethernet Controllers Over SSP
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - Frames move between the chip's buffer memory and a fixed pool of
+ *   packet buffers with SSP_XferBlock(), straight into / out of the packet
+ *   that the application gets or hands over; nothing is copied in between.
+ *
+ * - Received frames wait on a receive queue until ENC28J60_Recv(); frames
+ *   to send wait on a transmit queue.  ENC28J60_Poll() moves things along:
+ *   call it from the main loop, or whenever the chip's INT pin goes low.
+ *   When the pool runs dry, frames are left in the chip's 6.5K receive
+ *   buffer until packets are freed, rather than dropped.
+ *
+ * - None of this is interrupt safe; call it all from one context.
+ *
+ * - The SSP should be set up as master, 8 bit frames, SPI mode 0, at up to
+ *   20MHz (e.g. SSP_SetClockFrequency(SSP, 20000000)).  The chip select
+ *   pin should be a GPIO output, driven high.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_ENC28J60_H_
+#define LPC2XXX_ENC28J60_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_gpio.h"
+
+
+/** @addtogroup ENC28J60 ENC28J60 SPI Ethernet
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup ENC28J60_Defines
+  * @{
+  */
+
+#define ENC28J60_MAX_FRAME      (1518)  /*!< Largest frame, less the FCS     */
+
+/*! @brief Rx / Tx queue lengths (power of 2); may be overridden */
+#ifndef ENC28J60_QUEUE_SIZE
+#define ENC28J60_QUEUE_SIZE     (8)
+#endif
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup ENC28J60_Types
+  * @{
+  */
+
+/*! @brief One packet buffer */
+typedef struct ENC28J60_Packet_Struct {
+    struct ENC28J60_Packet_Struct *Next;  /*!< Free list link (internal)    */
+    uint16_t                 Len;         /*!< Bytes of frame in Data       */
+    uint8_t                  Data[ENC28J60_MAX_FRAME]; /*!< Ethernet frame,
+                                                 from destination MAC on    */
+} ENC28J60_Packet_Type;
+
+/*! @brief State for one ENC28J60 */
+typedef struct {
+    SSP_Type                *SSP;         /*!< SSP the chip is on           */
+    GPIO_Type               *CSPort;      /*!< Chip select port             */
+    uint32_t                 CSPin;       /*!< Chip select pin, active low  */
+    uint8_t                  Bank;        /*!< Register bank selected       */
+
+    uint16_t                 RxNext;      /*!< Chip address of next frame   */
+
+    ENC28J60_Packet_Type    *Free;        /*!< Unused packets               */
+    ENC28J60_Packet_Type    *RxQ[ENC28J60_QUEUE_SIZE]; /*!< Received frames */
+    uint8_t                  RxHead;      /*!< Next RxQ slot to fill        */
+    uint8_t                  RxTail;      /*!< Next RxQ slot to take        */
+    ENC28J60_Packet_Type    *TxQ[ENC28J60_QUEUE_SIZE]; /*!< Frames to send */
+    uint8_t                  TxHead;      /*!< Next TxQ slot to fill        */
+    uint8_t                  TxTail;      /*!< Next TxQ slot to send        */
+    ENC28J60_Packet_Type    *TxBusy;      /*!< Frame being sent             */
+
+    uint32_t                 RxFrames;    /*!< Frames received              */
+    uint32_t                 RxErrors;    /*!< Frames dropped: bad / long   */
+    uint32_t                 TxFrames;    /*!< Frames sent                  */
+    uint32_t                 TxErrors;    /*!< Frames that failed to send   */
+} ENC28J60_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup ENC28J60_Functions ENC28J60 Exported Functions
+  * @{
+  */
+
+/** @brief  Reset and set up an ENC28J60, and start receiving
+  *
+  * @param  [out] E        Controller state to initialize
+  * @param  [in]  SSP      The SSP the chip is on (set up already)
+  * @param  [in]  CSPort   Chip select GPIO port
+  * @param  [in]  CSPin    Chip select pin (as a mask)
+  * @param  [in]  Mac      The station's MAC address
+  * @param  [in]  Pool     Packet buffers
+  * @param  [in]  Count    Number of packets in Pool
+  *
+  * @return The chip's revision ID, or 0 if nothing answered.
+  *
+  * Sets the chip up for half duplex, taking unicast frames for Mac and
+  *  broadcasts with good CRCs.
+  */
+uint8_t ENC28J60_Init(ENC28J60_Type *E, SSP_Type *SSP, GPIO_Type *CSPort, uint32_t CSPin,
+                      const uint8_t Mac[6], ENC28J60_Packet_Type *Pool, uint16_t Count);
+
+/** @brief  Move frames between the chip and the queues
+  *
+  * @param  [in]  E        Controller state
+  *
+  * @return None.
+  *
+  * Reads in as many waiting frames as there are free packets and room on
+  *  the receive queue, and starts the next transmit once the last is done.
+  */
+void ENC28J60_Poll(ENC28J60_Type *E);
+
+/** @brief  Take a packet from the pool
+  *
+  * @param  [in]  E        Controller state
+  *
+  * @return A packet to fill in and ENC28J60_Send(), or 0 if none are free.
+  */
+ENC28J60_Packet_Type *ENC28J60_Alloc(ENC28J60_Type *E);
+
+/** @brief  Give a packet back to the pool
+  *
+  * @param  [in]  E        Controller state
+  * @param  [in]  P        The packet
+  *
+  * @return None.
+  */
+void ENC28J60_Free(ENC28J60_Type *E, ENC28J60_Packet_Type *P);
+
+/** @brief  Take the oldest received frame off the receive queue
+  *
+  * @param  [in]  E        Controller state
+  *
+  * @return The packet (to be freed or re-sent when done), or 0 if none.
+  */
+ENC28J60_Packet_Type *ENC28J60_Recv(ENC28J60_Type *E);
+
+/** @brief  Queue a frame to send
+  *
+  * @param  [in]  E        Controller state
+  * @param  [in]  P        The packet, Data and Len filled in (short frames
+  *                         are padded by the chip)
+  *
+  * @return 1 if queued, 0 if the transmit queue is full.
+  *
+  * The packet goes back to the pool once sent.
+  */
+uint8_t ENC28J60_Send(ENC28J60_Type *E, ENC28J60_Packet_Type *P);
+
+/** @brief  Determine Whether the Link is Up
+  *
+  * @param  [in]  E        Controller state
+  *
+  * @return 1 if the PHY has a link, 0 otherwise.
+  */
+uint8_t ENC28J60_LinkIsUp(ENC28J60_Type *E);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_ENC28J60_H_ */
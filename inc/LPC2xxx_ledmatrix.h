@@ -0,0 +1,263 @@
+/******************************************************************************
+ * @file:    LPC2xxx_ledmatrix.h
+ * @purpose: Header File for a Multiplexed LED Matrix Scan Engine
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - Rows are lit one at a time, with 8 bit greyscale from binary coded
+ *   modulation: each row is shown once per bit plane, for a time in
+ *   proportion to the bit's weight.  That's 8 slices per row per frame
+ *   rather than 255 PWM steps, and each slice is two short interrupts.
+ *
+ * - A CT16B runs the slices.  MR1 marks the start of each slice (and
+ *   resets the counter): its interrupt puts up the slice's columns and
+ *   turns the row on.  MR0 turns the row off again; moving it sets the
+ *   overall brightness without touching the greyscale.
+ *
+ * - Columns (up to 32) come from either FIO port-wide set / clear writes,
+ *   or shift registers fed by an SSP.  With the SSP, each slice's data is
+ *   shifted out while the previous slice is showing and latched at the
+ *   start of the slice, so the interrupt never waits for the SSP.
+ *
+ * - Frames are double buffered: LEDMatrix_LoadFrame() converts a greyscale
+ *   image into the back buffer's bit planes, and LEDMatrix_Swap() makes it
+ *   the one shown at the next frame boundary.
+ *
+ * - Each slice is at least BaseTicks timer counts long, which must be more
+ *   than the worst interrupt latency (and, with an SSP, the time it takes
+ *   to shift a row's data out).  The frame rate is
+ *   PCLK / (Prescaler + 1) / (Rows * 255 * BaseTicks).
+ *
+ * - Row and column pins should be set up as FIO outputs (rows driven low
+ *   = off); the SSP, if used, as an 8 bit master.  The timer's VIC routing
+ *   is left to the application; its timer IRQ handler should call
+ *   LEDMatrix_IRQHandler(), then VIC_IRQDone().
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_LEDMATRIX_H_
+#define LPC2XXX_LEDMATRIX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_ct16b.h"
+#include "LPC2xxx_ssp.h"
+
+
+/** @addtogroup LEDMatrix LED Matrix Scan Engine
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup LEDMatrix_Defines
+  * @{
+  */
+
+#define LEDMATRIX_PLANES               (8)  /*!< Greyscale bits             */
+#define LEDMATRIX_MAX_COLUMNS          (32) /*!< Columns per row, at most   */
+
+/*! @brief Words needed for each of the two frame buffers */
+#define LEDMATRIX_BUFFER_WORDS(Rows)   ((Rows) * LEDMATRIX_PLANES)
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup LEDMatrix_Types
+  * @{
+  */
+
+/*! @brief Board wiring and timing; must stay put while the matrix runs */
+typedef struct {
+    CT16B_Type              *Timer;      /*!< Slice timer (MR0 / MR1 used)    */
+    uint16_t                 Prescaler;  /*!< Timer prescaler                 */
+    uint16_t                 BaseTicks;  /*!< Length of the shortest slice    */
+
+    FIO_Type                *RowPort;    /*!< Port the row drivers are on     */
+    const uint32_t          *RowPins;    /*!< Pin mask for each row, active hi*/
+    uint8_t                  Rows;       /*!< Number of rows                  */
+    uint8_t                  Columns;    /*!< Number of columns (1 - 32)      */
+
+    SSP_Type                *SSP;        /*!< Column shift registers' SSP, or
+                                              NULL for FIO column pins        */
+    FIO_Type                *ColPort;    /*!< FIO: port the column pins are on;
+                                              SSP: port the latch pin is on   */
+    uint8_t                  ColShift;   /*!< FIO: port bit of column 0       */
+    uint32_t                 LatchPin;   /*!< SSP: latch pin (rising edge)    */
+} LEDMatrix_Config_Type;
+
+/*! @brief State for one LED matrix.
+  *
+  * Buffers hold a word per row per bit plane, bit c for column c.
+  */
+typedef struct {
+    const LEDMatrix_Config_Type *Config; /*!< Wiring and timing               */
+
+    uint32_t                *Front;      /*!< Buffer being shown              */
+    uint32_t                *Back;       /*!< Buffer being drawn into         */
+    volatile uint8_t         SwapPending;/*!< Swap at the next frame boundary */
+
+    uint8_t                  Row;        /*!< Row of the next slice           */
+    uint8_t                  Plane;      /*!< Plane of the next slice         */
+    uint32_t                 Lit;        /*!< Row pin that's on (0 = none)    */
+    uint32_t                 ColMask;    /*!< FIO: column pins on ColPort     */
+    uint16_t                 On[LEDMATRIX_PLANES];     /*!< Row on time      */
+    uint16_t                 Period[LEDMATRIX_PLANES]; /*!< Slice length     */
+
+    volatile uint32_t        Frames;     /*!< Frames shown                    */
+} LEDMatrix_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup LEDMatrix_Functions LED Matrix Exported Functions
+  * @{
+  */
+
+/** @brief  Set up and start scanning an LED matrix
+  *
+  * @param  [out] M        Matrix state to initialize
+  * @param  [in]  Config   Wiring and timing
+  * @param  [in]  BufA     First frame buffer, LEDMATRIX_BUFFER_WORDS() words
+  * @param  [in]  BufB     Second frame buffer, the same size
+  *
+  * @return None.
+  *
+  * Both buffers are cleared, and the brightness is set to full.  The
+  *  timer's VIC slot should be set up by the caller.
+  */
+void LEDMatrix_Init(LEDMatrix_Type *M, const LEDMatrix_Config_Type *Config,
+                    uint32_t *BufA, uint32_t *BufB);
+
+/** @brief  Convert a greyscale image into the back buffer
+  *
+  * @param  [in]  M        Matrix state
+  * @param  [in]  Grey     Rows * Columns levels (0 - 255), row by row
+  *
+  * @return None.
+  *
+  * Mustn't be called while a swap is pending.
+  */
+void LEDMatrix_LoadFrame(LEDMatrix_Type *M, const uint8_t *Grey);
+
+/** @brief  Set the overall brightness
+  *
+  * @param  [in]  M        Matrix state
+  * @param  [in]  Level    0 (off) - 256 (full)
+  *
+  * @return None.
+  *
+  * Scales how long each row is on within its slices.  Very low levels
+  *  shorten the dimmest slices below the interrupt latency, and the
+  *  bottom greyscale bits stop being exact.
+  */
+void LEDMatrix_SetBrightness(LEDMatrix_Type *M, uint16_t Level);
+
+/** @brief  Service the timer's interrupt
+  *
+  * @param  [in]  M        Matrix state
+  *
+  * @return None.
+  *
+  * Does NOT acknowledge the VIC.
+  */
+void LEDMatrix_IRQHandler(LEDMatrix_Type *M);
+
+/**
+  * @}
+  */
+
+
+/* Inline Functions ---------------------------------------------------------*/
+
+/** @defgroup LEDMatrix_Inline_Functions
+  * @{
+  */
+
+/** @brief  Get the Buffer to Draw Into
+  * @param  M       Matrix state
+  * @return The back buffer (a word per row per plane, bit c for column c),
+  *          or 0 if a swap is still pending
+  */
+__INLINE static uint32_t *LEDMatrix_GetBackBuffer(LEDMatrix_Type *M)
+{
+    return M->SwapPending ? 0 : M->Back;
+}
+
+/** @brief  Show the Back Buffer From the Next Frame On
+  * @param  M       Matrix state
+  * @return None.
+  */
+__INLINE static void LEDMatrix_Swap(LEDMatrix_Type *M)
+{
+    M->SwapPending = 1;
+}
+
+/** @brief  Determine Whether a Swap is Still Waiting for the Frame to End
+  * @param  M       Matrix state
+  * @return 1 if pending, 0 once the back buffer is free again
+  */
+__INLINE static uint8_t LEDMatrix_SwapIsPending(LEDMatrix_Type *M)
+{
+    return M->SwapPending;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_LEDMATRIX_H_ */
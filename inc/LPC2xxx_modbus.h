@@ -0,0 +1,227 @@
+/******************************************************************************
+ * @file:    LPC2xxx_modbus.h
+ * @purpose: Header File for Interrupt-Driven Modbus RTU Slave
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - The slave owns one UART and one TIMER.  Every received byte restarts
+ *   the timer, whose MR0 match fires exactly t3.5 after the last byte; the
+ *   frame is checked and answered from that interrupt.  Nothing is polled.
+ *
+ * - The Rx FIFO trigger is set to 1 byte so the timer is restarted as each
+ *   byte lands; with a deeper trigger the character timeout interrupt
+ *   (3.5 - 4.5 character times) would already be too late for t3.5.
+ *
+ * - Responses are built in place over the request and sent straight from
+ *   that buffer, a FIFO load per THRE interrupt.  After the last load the
+ *   timer is restarted; the slave keeps ignoring received bytes (its own
+ *   echo on a half-duplex bus) until that t3.5 expires with TEMT set, then
+ *   flushes the Rx FIFO and goes back to listening.
+ *
+ * - Register access goes through the application's callbacks, which are
+ *   called from the timer ISR.
+ *
+ * - Line settings (baud rate, 8E1 / 8N2, etc.), pin / power setup and VIC
+ *   routing are left to the application.  Its UART and TIMER IRQ handlers
+ *   should call Modbus_UARTIRQHandler() / Modbus_TimerIRQHandler(), then
+ *   VIC_IRQDone().
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_MODBUS_H_
+#define LPC2XXX_MODBUS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart.h"
+#include "LPC2xxx_timer.h"
+
+
+/** @addtogroup Modbus Modbus RTU Slave
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup Modbus_Defines
+  * @{
+  */
+
+#define MODBUS_ADU_MAX                  (256)   /*!< Largest RTU frame        */
+#define MODBUS_BROADCAST                (0)     /*!< Broadcast slave address  */
+
+#define MODBUS_FC_READ_HOLDING          (0x03)  /*!< Read Holding Registers   */
+#define MODBUS_FC_READ_INPUT            (0x04)  /*!< Read Input Registers     */
+#define MODBUS_FC_WRITE_SINGLE          (0x06)  /*!< Write Single Register    */
+#define MODBUS_FC_WRITE_MULTIPLE        (0x10)  /*!< Write Multiple Registers */
+
+#define MODBUS_EX_NONE                  (0x00)  /*!< Success                  */
+#define MODBUS_EX_ILLEGAL_FUNCTION      (0x01)  /*!< Function not supported   */
+#define MODBUS_EX_ILLEGAL_DATA_ADDRESS  (0x02)  /*!< Register doesn't exist   */
+#define MODBUS_EX_ILLEGAL_DATA_VALUE    (0x03)  /*!< Bad count / value        */
+#define MODBUS_EX_SLAVE_DEVICE_FAILURE  (0x04)  /*!< Couldn't carry it out    */
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup Modbus_Types
+  * @{
+  */
+
+/*! @brief Register tables reachable through the read callback */
+typedef enum {
+    Modbus_Table_Holding = 0,      /*!< Holding registers (FC 3, 6, 16)      */
+    Modbus_Table_Input,            /*!< Input registers (FC 4)               */
+} Modbus_Table_Type;
+
+/*! @brief Read one register; returns MODBUS_EX_NONE or an exception code */
+typedef uint8_t (*Modbus_ReadCallback_Type)(void *Arg, Modbus_Table_Type Table,
+                                            uint16_t Addr, uint16_t *Value);
+
+/*! @brief Write one holding register; returns MODBUS_EX_NONE or an exception */
+typedef uint8_t (*Modbus_WriteCallback_Type)(void *Arg, uint16_t Addr, uint16_t Value);
+
+/*! @brief Progress of the current frame */
+typedef enum {
+    Modbus_State_Idle = 0,         /*!< Waiting for a frame                  */
+    Modbus_State_Receiving,        /*!< Frame coming in; t3.5 timer running  */
+    Modbus_State_Transmitting,     /*!< Sending a response (until TEMT)      */
+} Modbus_State_Type;
+
+/*! @brief State for one Modbus RTU slave */
+typedef struct {
+    UART_Type                 *Uart;      /*!< UART on the bus               */
+    TIMER_Type                *Timer;     /*!< Timer for t3.5 (MR0 is used)  */
+    uint8_t                    Address;   /*!< This slave's address          */
+
+    Modbus_ReadCallback_Type   Read;      /*!< Register read callback        */
+    Modbus_WriteCallback_Type  Write;     /*!< Register write callback       */
+    void                      *Arg;       /*!< Passed to the callbacks       */
+
+    volatile Modbus_State_Type State;     /*!< Current progress              */
+    uint16_t                   Len;       /*!< Bytes in Buf                  */
+    uint16_t                   Crc;       /*!< Running CRC of Buf            */
+    uint8_t                    Bad;       /*!< Line error / overlong frame   */
+    const uint8_t             *TxData;    /*!< Next response byte to send    */
+    uint16_t                   TxLeft;    /*!< Response bytes left to send   */
+
+    volatile uint32_t          Frames;    /*!< Good frames for this slave    */
+    volatile uint32_t          CrcErrors; /*!< Frames dropped for bad CRC    */
+    volatile uint32_t          Errors;    /*!< Frames dropped otherwise      */
+
+    uint8_t                    Buf[MODBUS_ADU_MAX]; /*!< Request / response  */
+} Modbus_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup Modbus_Functions Modbus RTU Slave Exported Functions
+  * @{
+  */
+
+/** @brief  Set up a Modbus RTU slave and start listening
+  *
+  * @param  [out] MB       Slave state to initialize
+  * @param  [in]  Uart     UART on the bus (line settings already done)
+  * @param  [in]  Timer    Timer to use for frame timing (MR0)
+  * @param  [in]  Address  Slave address (1 - 247)
+  * @param  [in]  Baud     The UART's baud rate (for t3.5)
+  * @param  [in]  Read     Register read callback
+  * @param  [in]  Write    Holding register write callback (0 = read only)
+  * @param  [in]  Arg      Passed to the callbacks
+  *
+  * @return None.
+  *
+  * Per the spec, above 19200 baud t3.5 is fixed at 1.75ms.
+  */
+void Modbus_Init(Modbus_Type *MB, UART_Type *Uart, TIMER_Type *Timer,
+                 uint8_t Address, uint32_t Baud,
+                 Modbus_ReadCallback_Type Read, Modbus_WriteCallback_Type Write,
+                 void *Arg);
+
+/** @brief  Service the slave's UART interrupt
+  *
+  * @param  [in]  MB       Slave state
+  *
+  * @return None.
+  */
+void Modbus_UARTIRQHandler(Modbus_Type *MB);
+
+/** @brief  Service the slave's TIMER interrupt (end of frame)
+  *
+  * @param  [in]  MB       Slave state
+  *
+  * @return None.
+  */
+void Modbus_TimerIRQHandler(Modbus_Type *MB);
+
+/** @brief  Calculate the Modbus CRC of a block of data
+  *
+  * @param  [in]  Crc      Starting value (0xffff for a new frame)
+  * @param  [in]  Data     Bytes to add to the CRC
+  * @param  [in]  Len      Number of bytes
+  *
+  * @return The updated CRC.  A frame including its (little-endian) CRC
+  *          checks out to 0.
+  */
+uint16_t Modbus_CRC(uint16_t Crc, const uint8_t *Data, uint16_t Len);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_MODBUS_H_ */
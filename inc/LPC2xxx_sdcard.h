@@ -0,0 +1,209 @@
+/******************************************************************************
+ * @file:    LPC2xxx_sdcard.h
+ * @purpose: Header File for SD / MMC Card Block Access Over SSP
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - Talks to the card in SPI mode.  SDv1, SDv2 (SDSC / SDHC / SDXC) and
+ *   MMC cards are recognized.
+ *
+ * - Runs that cross more than one block use CMD18 / CMD25, so the card
+ *   streams (or takes) data without a command per block.  Multi-block
+ *   writes are preceded by ACMD23 on SD cards, which lets the card pre-erase
+ *   the whole run; on most cards this is worth several times the throughput
+ *   of single block writes.
+ *
+ * - Identification runs at 400kHz; SCK is then raised as close to 25MHz as
+ *   the SSP's dividers and the APB clock allow without going over.
+ *
+ * - Everything here blocks.  Timeouts are counted in bytes clocked, sized
+ *   for the card's worst case at full speed.
+ *
+ * - The SSP's pins and power should already be set up.  The chip select
+ *   pin should be a GPIO output, driven high.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_SDCARD_H_
+#define LPC2XXX_SDCARD_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_gpio.h"
+
+
+/** @addtogroup SDCard SD / MMC Card
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup SDCard_Defines
+  * @{
+  */
+
+#define SDCARD_BLOCK_SIZE        (512)       /*!< Bytes per block               */
+
+#define SDCARD_INIT_HZ           (400000)    /*!< SCK during identification     */
+#define SDCARD_MAX_HZ            (25000000)  /*!< Fastest SCK in SPI mode       */
+
+/*! @brief Bytes to wait for a read's data token (100ms at 25MHz) */
+#ifndef SDCARD_READ_TRIES
+#define SDCARD_READ_TRIES        (312500)
+#endif
+
+/*! @brief Bytes to wait out a busy card (500ms at 25MHz) */
+#ifndef SDCARD_BUSY_TRIES
+#define SDCARD_BUSY_TRIES        (1562500)
+#endif
+
+/*! @brief Times to ask a card whether it's done initializing (> 1s) */
+#ifndef SDCARD_INIT_TRIES
+#define SDCARD_INIT_TRIES        (4000)
+#endif
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup SDCard_Types
+  * @{
+  */
+
+/*! @brief Result of a card operation */
+typedef enum {
+    SDCard_Result_OK = 0,          /*!< Success                              */
+    SDCard_Result_NoCard,          /*!< Nothing answered                     */
+    SDCard_Result_Unusable,        /*!< Card won't work at our voltage, etc. */
+    SDCard_Result_Timeout,         /*!< Card didn't answer in time           */
+    SDCard_Result_CommandError,    /*!< Card rejected a command              */
+    SDCard_Result_DataError,       /*!< Read error token / write rejected    */
+} SDCard_Result_Type;
+
+/*! @brief Kinds of card */
+typedef enum {
+    SDCard_Kind_None = 0,          /*!< Not initialized                      */
+    SDCard_Kind_MMC,               /*!< MMC                                  */
+    SDCard_Kind_SDv1,              /*!< SD version 1.x                       */
+    SDCard_Kind_SDv2,              /*!< SD version 2+, byte addressed (SDSC) */
+    SDCard_Kind_SDHC,              /*!< SD version 2+, block addressed       */
+} SDCard_Kind_Type;
+
+/*! @brief State for one card */
+typedef struct {
+    SSP_Type                *SSP;       /*!< SSP the card is on               */
+    GPIO_Type               *CSPort;    /*!< Chip select port                 */
+    uint32_t                 CSPin;     /*!< Chip select pin, active low      */
+
+    SDCard_Kind_Type         Kind;      /*!< What was found                   */
+    uint32_t                 Hz;        /*!< SCK rate in use                  */
+} SDCard_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup SDCard_Functions SD / MMC Card Exported Functions
+  * @{
+  */
+
+/** @brief  Identify and set up a card
+  *
+  * @param  [out] SD       Card state to initialize
+  * @param  [in]  SSP      The SSP the card is on
+  * @param  [in]  CSPort   Chip select GPIO port
+  * @param  [in]  CSPin    Chip select pin (as a mask)
+  *
+  * @return SDCard_Result_OK if the card is ready for use.
+  *
+  * Sets the SSP up (master, 8 bit SPI mode 0) and leaves it at the fastest
+  *  rate the card allows.  May be called again after a card change.
+  */
+SDCard_Result_Type SDCard_Init(SDCard_Type *SD, SSP_Type *SSP,
+                               GPIO_Type *CSPort, uint32_t CSPin);
+
+/** @brief  Read blocks from the card
+  *
+  * @param  [in]  SD       Card state
+  * @param  [in]  Block    First block to read
+  * @param  [out] Data     Where to put the data (Count * 512 bytes)
+  * @param  [in]  Count    Number of blocks (at least 1)
+  *
+  * @return SDCard_Result_OK on success.
+  */
+SDCard_Result_Type SDCard_ReadBlocks(SDCard_Type *SD, uint32_t Block,
+                                     void *Data, uint32_t Count);
+
+/** @brief  Write blocks to the card
+  *
+  * @param  [in]  SD       Card state
+  * @param  [in]  Block    First block to write
+  * @param  [in]  Data     Data to write (Count * 512 bytes)
+  * @param  [in]  Count    Number of blocks (at least 1)
+  *
+  * @return SDCard_Result_OK on success.
+  *
+  * For the best throughput, write in runs as long as the application's
+  *  buffering allows.
+  */
+SDCard_Result_Type SDCard_WriteBlocks(SDCard_Type *SD, uint32_t Block,
+                                      const void *Data, uint32_t Count);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_SDCARD_H_ */
@@ -101,8 +101,8 @@ typedef enum {
    SPI_ClockPhase_A = 0x00, /*!< Data is latched on first clock transition   */
    SPI_ClockPhase_B = 0x08  /*!< Data is latched on second clock transition  */
 } SPI_ClockPhase_Type;
-#define SPI_IS_CLOCK_PHASE(Phase) (((Phase) == SPI_ClockPhaseA) \
-                                || ((Phase) == SPI_ClockPhaseB))
+#define SPI_IS_CLOCK_PHASE(Phase) (((Phase) == SPI_ClockPhase_A) \
+                                || ((Phase) == SPI_ClockPhase_B))
 
 /**
   * @}
@@ -117,8 +117,8 @@ typedef enum {
    SPI_ClockPolarity_Low  = 0x00, /*!< Clock line is low between frames      */
    SPI_ClockPolarity_High = 0x10  /*!< Clock line is high between frames     */
 } SPI_ClockPolarity_Type;
-#define SPI_IS_CLOCK_POLARITY(Polarity) (((Polarity) == SPI_ClockPolarityLow) \
-                                      || ((Polarity) == SPI_ClockPolarityHigh))
+#define SPI_IS_CLOCK_POLARITY(Polarity) (((Polarity) == SPI_ClockPolarity_Low) \
+                                      || ((Polarity) == SPI_ClockPolarity_High))
 
 /**
   * @}
@@ -133,8 +133,8 @@ typedef enum {
     SPI_Mode_Slave          = 0x00, /*!<  SPI is wire Slave                  */
     SPI_Mode_Master         = 0x20, /*!< SPI is wire Master                  */
 } SPI_Mode_Type;
-#define SPI_IS_MODE(Mode) (((Mode) == SPI_ModeMaster) \
-                        || ((Mode) == SPI_ModeSlave))
+#define SPI_IS_MODE(Mode) (((Mode) == SPI_Mode_Master) \
+                        || ((Mode) == SPI_Mode_Slave))
 
 /**
   * @}
@@ -396,8 +396,8 @@ __INLINE static uint8_t SPI_ITIsPending(SPI_Type *SPI)
   * @return None.
   */
 __INLINE static void SPI_ClearPendingIT(SPI_Type *SPI)
-{    
-    SPI->INT |= SPI_IT;
+{
+    SPI->INT = SPI_IT;
 }
 
 /** @brief  Get the Current Status Bits for an SPI Peripheral
@@ -0,0 +1,193 @@
+/******************************************************************************
+ * @file:    LPC2xxx_spi_xfer.h
+ * @purpose: Header File for Interrupt-Driven SPI Block Transfers
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - The legacy SPI has no FIFO, so each frame is moved from the SPIF
+ *   interrupt: the received frame is stored and the next one written to
+ *   SPDR straight away.  The CPU is free between frames.
+ *
+ * - Frames are whatever size the SPI is set to: 8 bits, or the alternate
+ *   length from SPI_SetAltWordLength() / SPI_EnableAltWordLength().  Frames
+ *   over 8 bits are stored as uint16_t.
+ *
+ * - The SPI should already be set up as master (clock rate, phase, etc.).
+ *   On parts where SSEL0 can't be moved off the pin, it must be held high.
+ *   Chip select is left to the caller.
+ *
+ * - Pin / power setup and the SPI's VIC routing are left to the
+ *   application; its SPI IRQ handler should call SPIXfer_IRQHandler(),
+ *   then VIC_IRQDone().
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_SPI_XFER_H_
+#define LPC2XXX_SPI_XFER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_spi.h"
+
+
+/** @addtogroup SPIXfer SPI Block Transfers
+  * @{
+  */
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup SPIXfer_Types
+  * @{
+  */
+
+/*! @brief Completion callback; called from the SPI's ISR */
+typedef void (*SPIXfer_Callback_Type)(void *Arg);
+
+/*! @brief State for interrupt-driven transfers on one SPI */
+typedef struct {
+    SPI_Type                *SPI;      /*!< SPI being serviced                 */
+
+    const uint8_t           *Tx;       /*!< Next frame to send (NULL = ones)   */
+    uint8_t                 *Rx;       /*!< Where the next frame goes          */
+    uint16_t                 Left;     /*!< Frames left, incl. one on the wire */
+    uint8_t                  Wide;     /*!< Frames are uint16_t                */
+    volatile uint8_t         Status;   /*!< SPI_Status_* errors this transfer  */
+
+    SPIXfer_Callback_Type    Done;     /*!< Called when finished (or NULL)     */
+    void                    *Arg;      /*!< Passed to Done                     */
+    volatile uint8_t         Busy;     /*!< 1 while a transfer is running      */
+} SPIXfer_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup SPIXfer_Functions SPI Block Transfer Exported Functions
+  * @{
+  */
+
+/** @brief  Set up an SPI for interrupt-driven block transfers
+  *
+  * @param  [out] X        Transfer state to initialize
+  * @param  [in]  SPI      The SPI to use (already set up as master)
+  *
+  * @return None.
+  */
+void SPIXfer_Init(SPIXfer_Type *X, SPI_Type *SPI);
+
+/** @brief  Start moving a block of frames
+  *
+  * @param  [in]  X        Transfer state
+  * @param  [in]  TxData   Frames to send (NULL sends all ones)
+  * @param  [out] RxData   Frames received (NULL drops them)
+  * @param  [in]  Count    Number of frames (at least 1)
+  * @param  [in]  Done     Called (from the ISR) once the last frame is in;
+  *                         may be NULL
+  * @param  [in]  Arg      Passed to Done
+  *
+  * @return 1 if the transfer was started, 0 if one is already running.
+  *
+  * Doesn't block.  The frame size is taken from the SPI's settings when
+  *  the transfer starts; buffers hold uint8_t frames up to 8 bits and
+  *  uint16_t above, and mustn't be touched until Done is called.  Done may
+  *  start the next transfer.
+  */
+uint8_t SPIXfer_Start(SPIXfer_Type *X, const void *TxData, void *RxData,
+                      uint16_t Count, SPIXfer_Callback_Type Done, void *Arg);
+
+/** @brief  Service the SPI's interrupt
+  *
+  * @param  [in]  X        Transfer state
+  *
+  * @return None.
+  *
+  * Does NOT acknowledge the VIC.
+  */
+void SPIXfer_IRQHandler(SPIXfer_Type *X);
+
+/**
+  * @}
+  */
+
+
+/* Inline Functions ---------------------------------------------------------*/
+
+/** @defgroup SPIXfer_Inline_Functions
+  * @{
+  */
+
+/** @brief  Determine Whether a Transfer is Running
+  * @param  X       Transfer state
+  * @return 1 if a transfer hasn't finished, 0 otherwise
+  */
+__INLINE static uint8_t SPIXfer_IsBusy(SPIXfer_Type *X)
+{
+    return X->Busy;
+}
+
+/** @brief  Get the Error Bits Seen During the Last Transfer
+  * @param  X       Transfer state
+  * @return ORed SPI_Status_Abort / ModeFault / ReadOverrun / WriteCollision
+  *          bits
+  *
+  * A mode fault ends the transfer early (Done is still called).
+  */
+__INLINE static uint8_t SPIXfer_GetErrors(SPIXfer_Type *X)
+{
+    return X->Status;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_SPI_XFER_H_ */
@@ -0,0 +1,250 @@
+/******************************************************************************
+ * @file:    LPC2xxx_spiflash.h
+ * @purpose: Header File for 25-Series SPI NOR Flash Over SSP
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - Reads use FAST_READ (0x0b) and stream the whole request in one command
+ *   with SSP_XferBlock(), so SCK runs back to back.
+ *
+ * - Small reads are served from a line cache filled with read-ahead from
+ *   the requested address, so walking through a log a record at a time
+ *   costs one command per line rather than one per record.  Reads of a
+ *   line or more bypass the cache.
+ *
+ * - Page programs and sector erases are started and left running; the
+ *   application calls SPIFlash_Poll() (from its main loop, a timer tick,
+ *   etc.) until it returns 0.  Multi-page writes are split on page
+ *   boundaries and carried on from SPIFlash_Poll().
+ *
+ * - The SSP should be set up as master, 8 bit frames, SPI mode 0 or 3.
+ *   The chip select pin should already be a GPIO output, driven high.
+ *   The SSP mustn't be shared with an SSPQueue.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_SPIFLASH_H_
+#define LPC2XXX_SPIFLASH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_gpio.h"
+
+
+/** @addtogroup SPIFlash SPI NOR Flash
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup SPIFlash_Defines
+  * @{
+  */
+
+/*! @brief Bytes in the read-ahead line (a power of 2); may be overridden */
+#ifndef SPIFLASH_LINE_SIZE
+#define SPIFLASH_LINE_SIZE         (32)
+#endif
+
+#define SPIFLASH_PAGE_SIZE         (256)    /*!< Page program unit             */
+#define SPIFLASH_SECTOR_SIZE       (4096)   /*!< Sector erase unit             */
+
+#define SPIFLASH_CMD_WRITE_ENABLE  (0x06)   /*!< Set the write enable latch    */
+#define SPIFLASH_CMD_READ_STATUS   (0x05)   /*!< Read status register 1        */
+#define SPIFLASH_CMD_FAST_READ     (0x0b)   /*!< Read, 1 dummy byte            */
+#define SPIFLASH_CMD_PAGE_PROGRAM  (0x02)   /*!< Program up to a page          */
+#define SPIFLASH_CMD_SECTOR_ERASE  (0x20)   /*!< Erase a 4K sector             */
+#define SPIFLASH_CMD_JEDEC_ID      (0x9f)   /*!< Manufacturer / device ID      */
+
+#define SPIFLASH_STATUS_BUSY       (1 << 0) /*!< Program / erase in progress   */
+#define SPIFLASH_STATUS_WEL        (1 << 1) /*!< Write enable latch set        */
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup SPIFlash_Types
+  * @{
+  */
+
+/*! @brief What the flash is busy with */
+typedef enum {
+    SPIFlash_State_Idle = 0,       /*!< Ready for commands                   */
+    SPIFlash_State_Programming,    /*!< Page program(s) running              */
+    SPIFlash_State_Erasing,        /*!< Sector erase running                 */
+} SPIFlash_State_Type;
+
+/*! @brief State for one SPI flash chip */
+typedef struct {
+    SSP_Type                *SSP;       /*!< SSP the chip is on               */
+    GPIO_Type               *CSPort;    /*!< Chip select port                 */
+    uint32_t                 CSPin;     /*!< Chip select pin, active low      */
+
+    SPIFlash_State_Type      State;     /*!< Operation in progress            */
+    const uint8_t           *WrData;    /*!< Next byte to program             */
+    uint32_t                 WrAddr;    /*!< Where it goes                    */
+    uint32_t                 WrLeft;    /*!< Bytes left to program            */
+
+    uint32_t                 LineAddr;  /*!< Flash address of Line[0]         */
+    uint8_t                  LineValid; /*!< Line holds flash contents        */
+    uint8_t                  Line[SPIFLASH_LINE_SIZE]; /*!< Read-ahead cache  */
+} SPIFlash_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup SPIFlash_Functions SPI Flash Exported Functions
+  * @{
+  */
+
+/** @brief  Set up access to an SPI flash chip
+  *
+  * @param  [out] F        Flash state to initialize
+  * @param  [in]  SSP      The SSP the chip is on (set up already)
+  * @param  [in]  CSPort   Chip select GPIO port
+  * @param  [in]  CSPin    Chip select pin (as a mask)
+  *
+  * @return The chip's JEDEC ID: manufacturer << 16 | type << 8 | capacity.
+  *          0 or 0xffffff means nothing answered.
+  *
+  * Waits out any program / erase left running across a reset first.
+  */
+uint32_t SPIFlash_Init(SPIFlash_Type *F, SSP_Type *SSP, GPIO_Type *CSPort, uint32_t CSPin);
+
+/** @brief  Read from the flash
+  *
+  * @param  [in]  F        Flash state
+  * @param  [in]  Addr     Flash address to start at
+  * @param  [out] Data     Where to put the bytes
+  * @param  [in]  Len      Number of bytes
+  *
+  * @return None.
+  *
+  * Waits for any program / erase to finish first.
+  */
+void SPIFlash_Read(SPIFlash_Type *F, uint32_t Addr, void *Data, uint32_t Len);
+
+/** @brief  Start programming data into (erased) flash
+  *
+  * @param  [in]  F        Flash state
+  * @param  [in]  Addr     Flash address to start at
+  * @param  [in]  Data     Bytes to program; must stay put until done
+  * @param  [in]  Len      Number of bytes (at least 1)
+  *
+  * @return 1 if started, 0 if the flash is busy.
+  *
+  * Only the first page (or part of one) is started here; the rest follow
+  *  from SPIFlash_Poll().
+  */
+uint8_t SPIFlash_Write(SPIFlash_Type *F, uint32_t Addr, const void *Data, uint32_t Len);
+
+/** @brief  Start erasing a 4K sector
+  *
+  * @param  [in]  F        Flash state
+  * @param  [in]  Addr     Any address in the sector
+  *
+  * @return 1 if started, 0 if the flash is busy.
+  */
+uint8_t SPIFlash_EraseSector(SPIFlash_Type *F, uint32_t Addr);
+
+/** @brief  Move a program / erase along
+  *
+  * @param  [in]  F        Flash state
+  *
+  * @return 1 if still busy, 0 once idle.
+  *
+  * Reads the status register (one short command) only while something is
+  *  running; starts the next page of a write once the last one is done.
+  */
+uint8_t SPIFlash_Poll(SPIFlash_Type *F);
+
+/**
+  * @}
+  */
+
+
+/* Inline Functions ---------------------------------------------------------*/
+
+/** @defgroup SPIFlash_Inline_Functions
+  * @{
+  */
+
+/** @brief  Determine Whether a Program / Erase is Running
+  * @param  F       Flash state
+  * @return 1 if busy (as of the last SPIFlash_Poll()), 0 otherwise
+  */
+__INLINE static uint8_t SPIFlash_IsBusy(SPIFlash_Type *F)
+{
+    return (F->State != SPIFlash_State_Idle) ? 1:0;
+}
+
+/** @brief  Drop the Read-Ahead Cache
+  * @param  F       Flash state
+  * @return None.
+  *
+  * Only needed if something other than this driver changes the flash.
+  */
+__INLINE static void SPIFlash_Invalidate(SPIFlash_Type *F)
+{
+    F->LineValid = 0;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_SPIFLASH_H_ */
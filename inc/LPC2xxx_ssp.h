@@ -152,9 +152,9 @@ typedef enum {
     SSP_Mode_Slave          = 0x04, /*!<  SSP is wire Slave                 */
     SSP_Mode_SlaveInputOnly = 0x0c  /*!< SSP is wire Slave, output disabled */
 } SSP_Mode_Type;
-#define SSP_IS_MODE(Mode) (((Mode) == SSP_ModeMaster) \
-                        || ((Mode) == SSP_ModeSlave)  \
-                        || ((Mode) == SSP_ModeSlaveInputOnly))
+#define SSP_IS_MODE(Mode) (((Mode) == SSP_Mode_Master) \
+                        || ((Mode) == SSP_Mode_Slave)  \
+                        || ((Mode) == SSP_Mode_SlaveInputOnly))
 
 /**
   * @}
@@ -191,10 +191,49 @@ typedef enum {
     SSP_IT_RxHalfFull          = 0x04, /*!< Rx FIFO at least half full   */
     SSP_IT_TxHalfEmpty         = 0x08, /*!<  Tx FIFO at least half empty */
 } SSP_IT_Type;
-#define SSP_IS_IT(Interrupt) (((Interrupt) == SSP_IT_RxOverrun)   \
-                           || ((Interrupt) == SSP_IT_RxTimeout)   \
-                           || ((Interrupt) == SSP_IT_RxHalfFull)  \
-                           || ((Interrupt) == SSP_IT_TxHalfEmpty))
+#define SSP_IS_IT(Interrupt) ((((Interrupt) & ~(SSP_IT_RxOverrun | SSP_IT_RxTimer    \
+                                             | SSP_IT_RxHalfFull | SSP_IT_TxHalfEmpty)) == 0) \
+                           && ((Interrupt) != 0))
+
+/**
+  * @}
+  */
+
+/** @defgroup SSP_FIFO_Size
+  * @{
+  */
+#define SSP_FifoSize     (8)    /*!< Depth of the SSP Tx / Rx FIFOs (frames) */
+
+/**
+  * @}
+  */
+
+/** @defgroup SSP_Clock_Calculation
+  * @{
+  *
+  * Compile-time SCK settings for a fixed PCLK, e.g. for an SSP_Init_Type:
+  *   .ClockPrescaler = SSP_CLOCK_PRESCALER(15000000, 4000000),
+  *   .ClockRate      = SSP_CLOCK_RATE(15000000, 4000000),
+  *
+  * SCK never exceeds Hz.  The prescaler is the smallest that can reach the
+  *  needed divider, which is the best possible for dividers up to 512 and
+  *  within 0.4% of it above that; SSP_CalcClock() searches them all.
+  */
+
+/*! @brief Smallest PCLK divider that keeps SCK at or under Hz */
+#define SSP_CLOCK_DIVIDER(PClk, Hz)   (((PClk) + (Hz) - 1) / (Hz))
+
+/*! @brief CPSDVSR for a fixed PCLK and target SCK */
+#define SSP_CLOCK_PRESCALER(PClk, Hz) (2 * ((SSP_CLOCK_DIVIDER(PClk, Hz) + 511) / 512))
+
+/*! @brief SCR for a fixed PCLK and target SCK */
+#define SSP_CLOCK_RATE(PClk, Hz)      ((SSP_CLOCK_DIVIDER(PClk, Hz)                 \
+                                        + SSP_CLOCK_PRESCALER(PClk, Hz) - 1)        \
+                                       / SSP_CLOCK_PRESCALER(PClk, Hz) - 1)
+
+/*! @brief SCK rate that SSP_CLOCK_PRESCALER / SSP_CLOCK_RATE give */
+#define SSP_CLOCK_ACTUAL(PClk, Hz)    ((PClk) / (SSP_CLOCK_PRESCALER(PClk, Hz)      \
+                                                 * (SSP_CLOCK_RATE(PClk, Hz) + 1)))
 
 /**
   * @}
@@ -388,9 +427,10 @@ __INLINE static uint8_t SSP_GetPendingIT(SSP_Type *SSP)
   */
 __INLINE static void SSP_ClearPendingIT(SSP_Type *SSP, SSP_IT_Type IT)
 {
-    lpc2xxx_lib_assert((IT == SSP_IT_RxOverrun) || (IT == SSP_IT_RxTimer));
+    lpc2xxx_lib_assert((IT & ~(SSP_IT_RxOverrun | SSP_IT_RxTimer)) == 0);
 
-    SSP->ICR |= IT;
+    /* Write-only; 1 bits clear, 0 bits are ignored */
+    SSP->ICR = IT;
 }
 
 /** @brief Set Master/Slave Modes on SSP
@@ -399,9 +439,9 @@ __INLINE static void SSP_ClearPendingIT(SSP_Type *SSP, SSP_IT_Type IT)
   * @return None.
   *
   * Mode may be:
-  *  SSP_ModeMaster
-  *  SSP_ModeSlave
-  *  SSP_ModeSlaveInputOnly
+  *  SSP_Mode_Master
+  *  SSP_Mode_Slave
+  *  SSP_Mode_SlaveInputOnly
   */
 __INLINE static void SSP_SetMode(SSP_Type *SSP, SSP_Mode_Type Mode)
 {
@@ -506,6 +546,81 @@ __INLINE static uint16_t SSP_Xfer(SSP_Type *SSP, uint16_t WordOut)
     return SSP->DR;
 }
 
+/**
+  * @}
+  */
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup SSP_Functions SSP Exported Functions
+  * @{
+  */
+
+/** @brief  Send and Receive a Block of Frames, Keeping the FIFO Full
+  *
+  * @param  [in]  SSP      The SSP device (in master mode)
+  * @param  [in]  TxData   Frames to send, or NULL to send all ones
+  * @param  [out] RxData   Where to put received frames, or NULL to discard
+  * @param  [in]  Count    Number of frames
+  *
+  * @return None.
+  *
+  * Frames are uint8_t for word lengths up to 8 bits, uint16_t above that.
+  *  Up to SSP_FifoSize frames are kept in flight, so SCK runs back to back
+  *  without the Rx FIFO ever overrunning.  Returns once the last frame has
+  *  been received.
+  */
+void SSP_XferBlock(SSP_Type *SSP, const void *TxData, void *RxData, uint32_t Count);
+
+/** @brief  Send a Block of Frames, Discarding What Comes Back
+  *
+  * @param  [in]  SSP      The SSP device (in master mode)
+  * @param  [in]  TxData   Frames to send (uint8_t / uint16_t, as above)
+  * @param  [in]  Count    Number of frames
+  *
+  * @return None.
+  */
+void SSP_WriteBlock(SSP_Type *SSP, const void *TxData, uint32_t Count);
+
+/** @brief  Receive a Block of Frames, Sending All Ones
+  *
+  * @param  [in]  SSP      The SSP device (in master mode)
+  * @param  [out] RxData   Where to put received frames (uint8_t / uint16_t)
+  * @param  [in]  Count    Number of frames
+  *
+  * @return None.
+  */
+void SSP_ReadBlock(SSP_Type *SSP, void *RxData, uint32_t Count);
+
+/** @brief  Find the Fastest SCK Settings Not Over a Target Rate
+  *
+  * @param  [in]  PClk      The SSP's APB clock (Hz)
+  * @param  [in]  Hz        Highest acceptable SCK rate
+  * @param  [out] Prescaler Where to put the CPSDVSR value
+  * @param  [out] Rate      Where to put the SCR value
+  *
+  * @return The SCK rate the settings give, or 0 if Hz is below the slowest
+  *          rate possible (Prescaler / Rate are left alone then).
+  *
+  * Tries every prescaler, so the result is the closest to Hz there is.
+  *  See SSP_CLOCK_PRESCALER() / SSP_CLOCK_RATE() for fixed clocks.
+  */
+uint32_t SSP_CalcClock(uint32_t PClk, uint32_t Hz,
+                       SSP_ClockPrescaler_Type *Prescaler, SSP_ClockRate_Type *Rate);
+
+/** @brief  Set SCK as Close to (but Not Over) a Target Rate as Possible
+  *
+  * @param  [in]  SSP      The SSP device
+  * @param  [in]  Hz       Highest acceptable SCK rate
+  *
+  * @return The SCK rate set, or 0 if Hz is too slow to reach (the clock
+  *          settings are left alone then).
+  *
+  * Works from the current APB clock (SystemCoreClock and the APB divider),
+  *  so should be called again if those change.
+  */
+uint32_t SSP_SetClockFrequency(SSP_Type *SSP, uint32_t Hz);
+
 /**
   * @}
   */
@@ -0,0 +1,213 @@
+/******************************************************************************
+ * @file:    LPC2xxx_ssp_queue.h
+ * @purpose: Header File for an Interrupt-Driven SSP Transaction Queue
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - Lets several devices share one SSP (master mode) without blocking:
+ *   each transfer carries its device's chip select and SSP settings, and
+ *   is run from the SSP interrupt when its turn comes.
+ *
+ * - The FIFOs are serviced on Tx half-empty / Rx half-full, with the Rx
+ *   timeout interrupt picking up the last few frames of each transfer.
+ *
+ * - Settings are only reloaded when the next transfer uses a different
+ *   SSP_Init_Type than the last, so point transfers for the same device
+ *   at the same (constant) settings.
+ *
+ * - Chip select pins should already be set up as GPIO outputs, driven
+ *   high.  Pin / power setup and the SSP's VIC routing are left to the
+ *   application; its SSP IRQ handler should call SSPQueue_IRQHandler(),
+ *   then VIC_IRQDone().
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_SSP_QUEUE_H_
+#define LPC2XXX_SSP_QUEUE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_gpio.h"
+
+
+/** @addtogroup SSPQueue SSP Transaction Queue
+  * @{
+  */
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup SSPQueue_Types
+  * @{
+  */
+
+/*! @brief Completion callback; called from the SSP's ISR */
+typedef void (*SSPQueue_Callback_Type)(void *Arg);
+
+/*! @brief One queued transfer.
+  *
+  * Owned by the queue from SSPQueue_Submit() until Busy goes back to 0 (just
+  *  before Done is called); it and its buffers mustn't be touched till then.
+  */
+typedef struct SSPQueue_Xfer_Struct {
+    const SSP_Init_Type          *Config;  /*!< Device's SSP settings (master) */
+    GPIO_Type                    *CSPort;  /*!< Chip select port (NULL = none) */
+    uint32_t                      CSPin;   /*!< Chip select pin, active low    */
+
+    const void                   *TxData;  /*!< Frames to send (NULL = ones)   */
+    void                         *RxData;  /*!< Frames received (NULL = drop)  */
+    uint16_t                      Count;   /*!< Number of frames (uint8_t up to
+                                                8 bits, uint16_t above)        */
+
+    SSPQueue_Callback_Type        Done;    /*!< Called when finished (or NULL) */
+    void                         *Arg;     /*!< Passed to Done                 */
+
+    struct SSPQueue_Xfer_Struct  *Next;    /*!< Queue link (internal)          */
+    volatile uint8_t              Busy;    /*!< 1 while queued / running       */
+} SSPQueue_Xfer_Type;
+
+/*! @brief State for one SSP's transaction queue */
+typedef struct {
+    SSP_Type                     *SSP;     /*!< SSP being serviced             */
+    IRQn_Type                     IRQn;    /*!< The SSP's IRQ number           */
+
+    SSPQueue_Xfer_Type * volatile Head;    /*!< Running transfer (NULL = idle) */
+    SSPQueue_Xfer_Type           *Tail;    /*!< Last queued transfer           */
+    const SSP_Init_Type          *Config;  /*!< Settings currently loaded      */
+
+    const uint8_t                *Tx;      /*!< Next frame to send             */
+    uint8_t                      *Rx;      /*!< Where the next frame goes      */
+    uint16_t                      TxLeft;  /*!< Frames left to send            */
+    uint16_t                      RxLeft;  /*!< Frames left to receive         */
+    uint8_t                       Wide;    /*!< Frames are uint16_t            */
+
+    volatile uint32_t             Xfers;   /*!< Transfers completed            */
+} SSPQueue_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup SSPQueue_Functions SSP Transaction Queue Exported Functions
+  * @{
+  */
+
+/** @brief  Set up an SSP for queued, interrupt-driven transfers
+  *
+  * @param  [out] Q        Queue state to initialize
+  * @param  [in]  SSP      The SSP to use
+  * @param  [in]  IRQn     The SSP's IRQ number (e.g. SSP0_IRQn)
+  *
+  * @return None.
+  *
+  * Puts the SSP in master mode and enables it.  The VIC slot should be set
+  *  up by the caller.
+  */
+void SSPQueue_Init(SSPQueue_Type *Q, SSP_Type *SSP, IRQn_Type IRQn);
+
+/** @brief  Queue a transfer
+  *
+  * @param  [in]  Q        Queue state
+  * @param  [in]  X        Transfer to run (Config, CS, buffers, Count, Done
+  *                         and Arg filled in)
+  *
+  * @return None.
+  *
+  * Doesn't block; starts the transfer right away if the SSP is idle.  May
+  *  be called from a Done callback to chain transfers.
+  */
+void SSPQueue_Submit(SSPQueue_Type *Q, SSPQueue_Xfer_Type *X);
+
+/** @brief  Service the SSP's interrupt
+  *
+  * @param  [in]  Q        Queue state
+  *
+  * @return None.
+  *
+  * Does NOT acknowledge the VIC.
+  */
+void SSPQueue_IRQHandler(SSPQueue_Type *Q);
+
+/**
+  * @}
+  */
+
+
+/* Inline Functions ---------------------------------------------------------*/
+
+/** @defgroup SSPQueue_Inline_Functions
+  * @{
+  */
+
+/** @brief  Determine Whether a Transfer is Still Queued or Running
+  * @param  X       Transfer
+  * @return 1 if the queue still owns it, 0 if it's finished
+  */
+__INLINE static uint8_t SSPQueue_IsBusy(SSPQueue_Xfer_Type *X)
+{
+    return X->Busy;
+}
+
+/** @brief  Determine Whether the Queue is Empty
+  * @param  Q       Queue state
+  * @return 1 if nothing is queued or running, 0 otherwise
+  */
+__INLINE static uint8_t SSPQueue_IsIdle(SSPQueue_Type *Q)
+{
+    return (Q->Head == 0) ? 1:0;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_SSP_QUEUE_H_ */
@@ -0,0 +1,250 @@
+/******************************************************************************
+ * @file:    LPC2xxx_ssp_slave.h
+ * @purpose: Header File for an Interrupt-Driven SSP Slave with Double
+ *           Buffered Responses
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - For keeping up with a master that clocks continuously.  The Tx FIFO is
+ *   kept topped up from the Tx half-empty interrupt, so the master never
+ *   finds it empty; the Rx FIFO is emptied into a ring from the half-full
+ *   and timeout interrupts.  Overruns are counted.
+ *
+ * - Responses alternate between two buffers: the application fills one
+ *   (SSPSlave_GetTxBuffer() / SSPSlave_CommitTx()) while the ISR sends the
+ *   other.  When neither has anything to send, the filler byte goes out.
+ *
+ * - Since the FIFO is always kept full, a response goes out after whatever
+ *   is already in it: up to SSP_FifoSize frames of filler.  Protocols
+ *   should allow for that many frames of turnaround.
+ *
+ * - Frames are 8 bits.  Frame format, clock phase and polarity should be
+ *   set (to match the master) before SSPSlave_Init().  Pin / power setup
+ *   and the SSP's VIC routing are left to the application; its SSP IRQ
+ *   handler should call SSPSlave_IRQHandler(), then VIC_IRQDone().
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_SSP_SLAVE_H_
+#define LPC2XXX_SSP_SLAVE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_ssp.h"
+
+
+/** @addtogroup SSPSlave SSP Slave
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup SSPSlave_Defines
+  * @{
+  */
+
+/*! @brief Check that a ring buffer size is a non-zero power of two <= 32768 */
+#define SSPSLAVE_IS_RING_SIZE(Size) (((Size) != 0) && ((Size) <= 32768) \
+                                  && (((Size) & ((Size) - 1)) == 0))
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup SSPSlave_Types
+  * @{
+  */
+
+/*! @brief State for one SSP slave.
+  *
+  * The ISR is the only writer of RxHead, TxNext and TxPos (and clears
+  *  TxReady); the application the only writer of RxTail and TxFill (and
+  *  sets TxReady).
+  */
+typedef struct {
+    SSP_Type                *SSP;        /*!< SSP being serviced               */
+    IRQn_Type                IRQn;       /*!< The SSP's IRQ number             */
+
+    uint8_t                 *RxBuf;      /*!< Receive ring storage             */
+    uint16_t                 RxMask;     /*!< Receive ring size - 1            */
+    volatile uint16_t        RxHead;     /*!< Next Rx slot to fill (ISR)       */
+    volatile uint16_t        RxTail;     /*!< Next Rx slot to read (app)       */
+
+    uint8_t                 *TxBuf[2];   /*!< Response buffers                 */
+    uint16_t                 TxSize;     /*!< Size of each response buffer     */
+    uint16_t                 TxLen[2];   /*!< Bytes committed to each          */
+    volatile uint8_t         TxReady[2]; /*!< Buffer committed, not yet sent   */
+    uint8_t                  TxFill;     /*!< Buffer the app fills next        */
+    uint8_t                  TxNext;     /*!< Buffer the ISR sends next        */
+    uint16_t                 TxPos;      /*!< Next byte of it to send          */
+    uint8_t                  Filler;     /*!< Sent when there's no response    */
+
+    volatile uint32_t        RxDropped;  /*!< Frames lost: ring was full       */
+    volatile uint32_t        Overruns;   /*!< Rx FIFO overruns                 */
+} SSPSlave_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup SSPSlave_Functions SSP Slave Exported Functions
+  * @{
+  */
+
+/** @brief  Start an SSP as an interrupt-driven slave
+  *
+  * @param  [out] S        Slave state to initialize
+  * @param  [in]  SSP      The SSP to use (frame settings already made)
+  * @param  [in]  IRQn     The SSP's IRQ number (e.g. SSP0_IRQn)
+  * @param  [in]  RxBuf    Receive ring storage
+  * @param  [in]  RxSize   Size of RxBuf (power of 2)
+  * @param  [in]  TxBufA   First response buffer
+  * @param  [in]  TxBufB   Second response buffer
+  * @param  [in]  TxSize   Size of each response buffer
+  * @param  [in]  Filler   Byte to send when no response is waiting
+  *
+  * @return None.
+  *
+  * Puts the SSP in slave mode with the Tx FIFO full of filler, then
+  *  enables it.  The VIC slot should be set up by the caller.
+  */
+void SSPSlave_Init(SSPSlave_Type *S, SSP_Type *SSP, IRQn_Type IRQn,
+                   uint8_t *RxBuf, uint16_t RxSize,
+                   uint8_t *TxBufA, uint8_t *TxBufB, uint16_t TxSize,
+                   uint8_t Filler);
+
+/** @brief  Retrieve received frames
+  *
+  * @param  [in]  S        Slave state
+  * @param  [out] Data     Where to store received bytes
+  * @param  [in]  Len      Maximum number of bytes to retrieve
+  *
+  * @return Number of bytes retrieved (0 if none were waiting).
+  */
+uint16_t SSPSlave_Read(SSPSlave_Type *S, uint8_t *Data, uint16_t Len);
+
+/** @brief  Service the SSP's interrupt
+  *
+  * @param  [in]  S        Slave state
+  *
+  * @return None.
+  *
+  * Does NOT acknowledge the VIC.
+  */
+void SSPSlave_IRQHandler(SSPSlave_Type *S);
+
+/**
+  * @}
+  */
+
+
+/* Inline Functions ---------------------------------------------------------*/
+
+/** @defgroup SSPSlave_Inline_Functions
+  * @{
+  */
+
+/** @brief  Get the Number of Received Bytes Waiting in the Rx Ring
+  * @param  S       Slave state
+  * @return Number of bytes that can be read
+  */
+__INLINE static uint16_t SSPSlave_RxAvailable(SSPSlave_Type *S)
+{
+    return (uint16_t)(S->RxHead - S->RxTail);
+}
+
+/** @brief  Get the Response Buffer to Fill Next
+  * @param  S       Slave state
+  * @return The buffer (TxSize bytes), or 0 if both are still waiting to go
+  */
+__INLINE static uint8_t *SSPSlave_GetTxBuffer(SSPSlave_Type *S)
+{
+    return S->TxReady[S->TxFill] ? 0 : S->TxBuf[S->TxFill];
+}
+
+/** @brief  Hand the Buffer From SSPSlave_GetTxBuffer() Over for Sending
+  * @param  S       Slave state
+  * @param  Len     Number of bytes filled in (1 - TxSize)
+  * @return None.
+  *
+  * Responses go out in the order they're committed.
+  */
+__INLINE static void SSPSlave_CommitTx(SSPSlave_Type *S, uint16_t Len)
+{
+    uint8_t Fill = S->TxFill;
+
+
+    lpc2xxx_lib_assert(!S->TxReady[Fill]);
+    lpc2xxx_lib_assert((Len != 0) && (Len <= S->TxSize));
+
+    S->TxLen[Fill] = Len;
+    S->TxReady[Fill] = 1;
+    S->TxFill = Fill ^ 1;
+}
+
+/** @brief  Determine Whether Any Committed Response Has Yet to be Sent
+  * @param  S       Slave state
+  * @return 1 if a response is waiting or going out, 0 otherwise
+  */
+__INLINE static uint8_t SSPSlave_TxIsPending(SSPSlave_Type *S)
+{
+    return (S->TxReady[0] || S->TxReady[1]) ? 1:0;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_SSP_SLAVE_H_ */
@@ -91,6 +91,7 @@ typedef enum {
     UART_ITID_RxLineStatus     = 0x06,
     UART_ITID_CharacterTimeOut = 0x0c,
 } UART_ITID_Type;
+#define UART_ITID_Mask           (0x000f)
 
 
 /**
@@ -198,6 +199,67 @@ typedef enum {
   * @}
   */ 
 
+/** @defgroup UART_FIFO_Sizes
+  * @{
+  */
+#define UART_TxFifoSize  (16)   /*!< Depth of the UART Tx FIFO (bytes) */
+#define UART_RxFifoSize  (16)   /*!< Depth of the UART Rx FIFO (bytes) */
+
+/**
+  * @}
+  */
+
+/** @defgroup UART_AutoBaud_Mode
+  * @{
+  */
+typedef enum {
+    UART_AutoBaudMode_0 = 0x00,  /*!< Measure start bit + bit 0 ('A' / 'a') */
+    UART_AutoBaudMode_1 = 0x02,  /*!< Measure start bit only               */
+} UART_AutoBaudMode_Type;
+#define UART_IS_AUTOBAUDMODE(MODE) (((MODE) == UART_AutoBaudMode_0) \
+                                 || ((MODE) == UART_AutoBaudMode_1))
+
+/**
+  * @}
+  */
+
+/** @defgroup UART_Baud_Config
+  * @{
+  *
+  * baud = PCLK / (16 * Divisor * (1 + DivAddVal / MulVal))
+  *
+  * Parts without a fractional divider (e.g. LPC2106, or an LPC213x that
+  *  isn't a /01 part -- see LPC2XXX_PART_01 in LPC2138.h) always use
+  *  DivAddVal = 0, MulVal = 1.
+  */
+typedef struct {
+    uint16_t Divisor;    /*!< Divisor latch value (DLM:DLL)                 */
+    uint8_t  DivAddVal;  /*!< Fractional divider DIVADDVAL (0 = no fraction) */
+    uint8_t  MulVal;     /*!< Fractional divider MULVAL (1 - 15)             */
+} UART_BaudConfig_Type;
+
+#ifdef LPC2XXX_HAS_UART_FDR
+# define UART_MaxMulVal  (15)   /*!< Largest MULVAL the baud solver tries   */
+#else
+# define UART_MaxMulVal  (1)    /*!< No fractional divider on this part     */
+#endif
+
+/* Full unroll of the solver's loops lets the compiler fold it to constants.
+ *  LPC2xxx_uart.c defines this empty first, so that the run-time
+ *  UART_CalcBaudConfig() shares the same body without being unrolled.
+ */
+#ifndef UART_BAUD_SOLVER_UNROLL
+# if defined(__GNUC__) && (__GNUC__ >= 8)
+#  define UART_BAUD_SOLVER_UNROLL _Pragma("GCC unroll 15")
+# else
+#  define UART_BAUD_SOLVER_UNROLL
+# endif
+#endif
+
+/**
+  * @}
+  */
+
 
 /* UART Inline Functions ----------------------------------------------------*/
 
@@ -282,6 +344,21 @@ __INLINE static uint16_t UART_GetPendingITID(UART_Type *Uart)
     return (Uart->IIR & UART_INTID_Mask);
 }
 
+/**
+  * @brief  Get Pending Interrupt ID and Auto-Baud Interrupt Status on Uart
+  * @param  Uart    Pointer to the UART instance
+  * @return UART_ITID_* value (UART_ITID_Mask bits) ORed with pending
+  *          UART_IT_AutoBaudEnd / UART_IT_AutoBaudTimeout flags
+  *
+  * Reading IIR clears a pending THRE interrupt, so an ISR that cares about
+  *  auto-baud interrupts should use this instead of UART_GetPendingITID()
+  *  rather than reading IIR twice.
+  */
+__INLINE static uint16_t UART_GetITStatus(UART_Type *Uart)
+{
+    return (Uart->IIR & (UART_ITID_Mask | UART_IT_AutoBaudEnd | UART_IT_AutoBaudTimeout));
+}
+
 /**
   * @brief  Set the word length for bytes sent/received via the UART
   * @param  Uart     Pointer to the UART instance
@@ -472,7 +549,7 @@ __INLINE static void UART_SetDTR(UART_Type *Uart, uint8_t Value)
     if (Value) {
         Uart->MCR |= UART_DTR;
     } else {
-        Uart->MCR &= UART_DTR;
+        Uart->MCR &= ~UART_DTR;
     }
 }
 
@@ -496,7 +573,7 @@ __INLINE static void UART_SetRTS(UART_Type *Uart, uint8_t Value)
     if (Value) {
         Uart->MCR |= UART_RTS;
     } else {
-        Uart->MCR &= UART_RTS;
+        Uart->MCR &= ~UART_RTS;
     }
 }
 
@@ -662,6 +739,255 @@ __INLINE static uint16_t UART_GetDivisor(UART_Type *Uart)
     return Divisor;
 }
 
+#ifdef LPC2XXX_HAS_UART_FDR
+
+/**
+  * @brief  Set the UART's Fractional Divider
+  * @param  Uart       Pointer to the UART instance
+  * @param  DivAddVal  Pre-scaler divisor value (0 - 14, less than MulVal)
+  * @param  MulVal     Pre-scaler multiplier value (1 - 15)
+  * @return None.
+  */
+__INLINE static void UART_SetFractionalDivider(UART_Type *Uart, uint8_t DivAddVal, uint8_t MulVal)
+{
+    lpc2xxx_lib_assert((MulVal >= 1) && (MulVal <= 15) && (DivAddVal < MulVal));
+
+    Uart->FDR = ((DivAddVal << UART_DIVADDVAL_Shift) & UART_DIVADDVAL_Mask)
+              | ((MulVal << UART_MULVAL_Shift) & UART_MULVAL_Mask);
+}
+
+/**
+  * @brief  Get the UART's Fractional Divider Pre-Scaler Divisor
+  * @param  Uart     Pointer to the UART instance
+  * @return The configured DIVADDVAL
+  */
+__INLINE static uint8_t UART_GetDivAddVal(UART_Type *Uart)
+{
+    return (Uart->FDR & UART_DIVADDVAL_Mask) >> UART_DIVADDVAL_Shift;
+}
+
+/**
+  * @brief  Get the UART's Fractional Divider Pre-Scaler Multiplier
+  * @param  Uart     Pointer to the UART instance
+  * @return The configured MULVAL
+  */
+__INLINE static uint8_t UART_GetMulVal(UART_Type *Uart)
+{
+    return (Uart->FDR & UART_MULVAL_Mask) >> UART_MULVAL_Shift;
+}
+
+#endif /* #ifdef LPC2XXX_HAS_UART_FDR */
+
+#ifdef LPC2XXX_HAS_UART_AUTOBAUD
+
+/**
+  * @brief  Start Auto-Baud Rate Detection
+  * @param  Uart         Pointer to the UART instance
+  * @param  Mode         Measurement mode (of UART_AutoBaudMode_Type type)
+  * @param  AutoRestart  1 to restart automatically on a timeout, 0 not to
+  * @return None.
+  *
+  * The measured divisor is loaded into DLM:DLL by the hardware.  The
+  *  fractional divider should be set to DivAddVal = 0 beforehand.
+  */
+__INLINE static void UART_StartAutoBaud(UART_Type *Uart, UART_AutoBaudMode_Type Mode, uint8_t AutoRestart)
+{
+    lpc2xxx_lib_assert(UART_IS_AUTOBAUDMODE(Mode));
+
+    Uart->ACR = UART_AUTOBAUD | Mode | (AutoRestart ? UART_AUTORESTART:0);
+}
+
+/**
+  * @brief  Stop Auto-Baud Rate Detection
+  * @param  Uart     Pointer to the UART instance
+  * @return None.
+  */
+__INLINE static void UART_StopAutoBaud(UART_Type *Uart)
+{
+    Uart->ACR = 0;
+}
+
+/**
+  * @brief  Determine Whether Auto-Baud Rate Detection is Running
+  * @param  Uart     Pointer to the UART instance
+  * @return 1 if running, 0 if finished or stopped
+  */
+__INLINE static uint8_t UART_AutoBaudIsRunning(UART_Type *Uart)
+{
+    return (Uart->ACR & UART_AUTOBAUD) ? 1:0;
+}
+
+/**
+  * @brief  Clear Pending Auto-Baud Interrupts
+  * @param  Uart     Pointer to the UART instance
+  * @param  IT       UART_IT_AutoBaudEnd and / or UART_IT_AutoBaudTimeout
+  * @return None.
+  */
+__INLINE static void UART_ClearAutoBaudIT(UART_Type *Uart, uint16_t IT)
+{
+    lpc2xxx_lib_assert((IT & ~(UART_IT_AutoBaudEnd | UART_IT_AutoBaudTimeout)) == 0);
+
+    /* Same bit positions as in IER / IIR; write 1 to clear */
+    Uart->ACR |= IT;
+}
+
+#endif /* #ifdef LPC2XXX_HAS_UART_AUTOBAUD */
+
+/**
+  * @brief  Load a Complete Baud Rate Generator Configuration
+  * @param  Uart     Pointer to the UART instance
+  * @param  Config   Settings (as from UART_CalcBaudConfig)
+  * @return None.
+  */
+__INLINE static void UART_SetBaudConfig(UART_Type *Uart, const UART_BaudConfig_Type *Config)
+{
+    UART_SetDivisor(Uart, Config->Divisor);
+#ifdef LPC2XXX_HAS_UART_FDR
+    UART_SetFractionalDivider(Uart, Config->DivAddVal, Config->MulVal);
+#endif
+}
+
+/**
+  * @brief  Calculate the Baud Rate Produced by a Baud Rate Configuration
+  * @param  PClk     The UART's peripheral (APB) clock, in Hz
+  * @param  Config   Baud rate generator settings
+  * @return The resulting baud rate (rounded), 0 if Config is invalid
+  */
+__INLINE static uint32_t UART_CalcBaudRate(uint32_t PClk, const UART_BaudConfig_Type *Config)
+{
+    uint32_t Den = 16 * (uint32_t)Config->Divisor
+                   * (uint32_t)(Config->MulVal + Config->DivAddVal);
+
+
+    if (Den == 0) {
+        return 0;
+    }
+
+    return ((PClk * Config->MulVal) + (Den / 2)) / Den;
+}
+
+/**
+  * @brief  Find the Divisor for One Fractional Divider Setting
+  * @param  PClk       The UART's peripheral (APB) clock, in Hz
+  * @param  Baud       Desired baud rate
+  * @param  DivAddVal  Fractional divider DIVADDVAL to try
+  * @param  MulVal     Fractional divider MULVAL to try
+  * @param  Divisor    Where to store the nearest divisor latch value
+  * @return |16 * Baud * Divisor * (MulVal + DivAddVal) - PClk * MulVal|, or
+  *          0xffffffff if no usable divisor exists for this setting.
+  *
+  * The relative error is the return value / (PClk * MulVal), so errors for
+  *  different MulVal's have to be scaled before comparing them.
+  */
+__INLINE static uint32_t UART_CalcBaudError(uint32_t PClk, uint32_t Baud,
+                                            uint8_t DivAddVal, uint8_t MulVal,
+                                            uint16_t *Divisor)
+{
+    uint32_t Num = PClk * MulVal;
+    uint32_t Den = 16 * Baud * (uint32_t)(MulVal + DivAddVal);
+    uint32_t DL = (Num + (Den / 2)) / Den;
+    uint32_t Actual;
+
+
+    /* DLL must be >= 3 when the fractional divider is in use */
+    if ((DL == 0) || (DL > 0xffff) || ((DivAddVal != 0) && (DL < 3))) {
+        return 0xffffffff;
+    }
+
+    *Divisor = DL;
+    Actual = DL * Den;
+
+    return (Actual > Num) ? (Actual - Num) : (Num - Actual);
+}
+
+/**
+  * @brief  Find the Minimum-Error Baud Rate Configuration (Constant Form)
+  * @param  PClk     The UART's peripheral (APB) clock, in Hz (<= 280MHz)
+  * @param  Baud     Desired baud rate
+  * @param  Config   Where to store the resulting settings
+  * @return The baud rate actually achieved, or 0 if Baud is too high
+  *
+  * Tries every DIVADDVAL / MULVAL pair the part supports.  Intended for
+  *  constant arguments, e.g. UART_CalcBaudConfigConst(F_CPU / 4, 115200, &c),
+  *  in which case (with -O2 and GCC >= 8) the whole search folds down to
+  *  three constants.  With run-time values use UART_CalcBaudConfig(), which
+  *  is this same search, not unrolled.
+  */
+__INLINE static uint32_t UART_CalcBaudConfigConst(uint32_t PClk, uint32_t Baud,
+                                                  UART_BaudConfig_Type *Config)
+{
+    uint32_t BestErr = 0xffffffff;
+    uint8_t BestMul = 0;
+    uint32_t Err;
+    uint16_t Divisor = 0;
+    uint8_t MulVal;
+    uint8_t DivAddVal;
+
+
+    Config->Divisor   = 0;
+    Config->DivAddVal = 0;
+    Config->MulVal    = 1;
+
+    UART_BAUD_SOLVER_UNROLL
+    for (MulVal = 1; MulVal <= UART_MaxMulVal; MulVal++) {
+        UART_BAUD_SOLVER_UNROLL
+        for (DivAddVal = 0; DivAddVal < MulVal; DivAddVal++) {
+            Err = UART_CalcBaudError(PClk, Baud, DivAddVal, MulVal, &Divisor);
+            if (Err == 0xffffffff) {
+                continue;
+            }
+
+            /* Err / MulVal < BestErr / BestMul; first (simplest) wins ties */
+            if ((BestMul == 0)
+             || ((uint64_t)Err * BestMul < (uint64_t)BestErr * MulVal))
+            {
+                BestErr = Err;
+                BestMul = MulVal;
+                Config->Divisor   = Divisor;
+                Config->DivAddVal = DivAddVal;
+                Config->MulVal    = MulVal;
+            }
+        }
+    }
+
+    return UART_CalcBaudRate(PClk, Config);
+}
+
+/**
+  * @}
+  */
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup UART_Functions UART Exported Functions
+  * @{
+  */
+
+/** @brief  Find the Minimum-Error Baud Rate Configuration
+  *
+  * @param  [in]  PClk     The UART's peripheral (APB) clock, in Hz
+  * @param  [in]  Baud     Desired baud rate
+  * @param  [out] Config   Where to store the resulting settings
+  *
+  * @return The baud rate actually achieved, or 0 if Baud is too high.
+  *
+  * Run-time equivalent of UART_CalcBaudConfigConst().
+  */
+uint32_t UART_CalcBaudConfig(uint32_t PClk, uint32_t Baud, UART_BaudConfig_Type *Config);
+
+/** @brief  Set a UART's Baud Rate Using the Current APB Clock
+  *
+  * @param  [in]  Uart     The UART to configure
+  * @param  [in]  Baud     Desired baud rate
+  *
+  * @return The baud rate actually achieved, or 0 if Baud is too high
+  *          (in which case the UART is left untouched).  Check the result
+  *          against Baud; at low PCLK some rates can't be hit closely.
+  *
+  * Uses SystemCoreClock and the APB divider to find PCLK.
+  */
+uint32_t UART_SetBaudRate(UART_Type *Uart, uint32_t Baud);
+
 /**
   * @}
   */
@@ -0,0 +1,184 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart_autobaud.h
+ * @purpose: Header File for Interrupt-Driven UART Auto-Baud Detection
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - The hardware measures the host's first character ('A' or 'a', e.g. the
+ *   start of "AT") and loads DLM:DLL.  That divisor is integer-only, so the
+ *   measured rate is snapped to the nearest standard rate and re-programmed
+ *   with the fractional divider for the lowest error.
+ *
+ * - While detection is running, the UART's IRQ handler should call
+ *   UARTAutoBaud_IRQHandler() (UARTBuf_IRQHandler() afterwards, if the
+ *   buffered layer is used), then VIC_IRQDone().
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_UART_AUTOBAUD_H_
+#define LPC2XXX_UART_AUTOBAUD_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart.h"
+
+#ifndef LPC2XXX_HAS_UART_AUTOBAUD
+#error  Your CPU does not seem to have UART auto-baud hardware, or a CPU header file is missing/incorrect.
+#endif
+
+
+/** @addtogroup UARTAutoBaud UART Auto-Baud Detection
+  * @{
+  */
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup UARTAutoBaud_Types
+  * @{
+  */
+
+/*! @brief Progress of an auto-baud detection */
+typedef enum {
+    UARTAutoBaud_State_Idle = 0,   /*!< Not started / stopped               */
+    UARTAutoBaud_State_Running,    /*!< Waiting for the host's character    */
+    UARTAutoBaud_State_Locked,     /*!< Rate found and programmed           */
+} UARTAutoBaud_State_Type;
+
+struct UARTAutoBaud_Struct;
+
+/*! @brief Lock callback; called from the UART's ISR */
+typedef void (*UARTAutoBaud_Callback_Type)(struct UARTAutoBaud_Struct *AB);
+
+/*! @brief State for one auto-baud detection */
+typedef struct UARTAutoBaud_Struct {
+    UART_Type                  *Uart;      /*!< UART being measured          */
+    uint32_t                    PClk;      /*!< UART's APB clock (Hz)        */
+    UARTAutoBaud_Callback_Type  Done;      /*!< Called once locked           */
+
+    volatile UARTAutoBaud_State_Type State; /*!< Current progress            */
+
+    uint32_t                    Measured;  /*!< Raw rate from the hardware   */
+    uint32_t                    Rate;      /*!< Rate locked onto             */
+    uint32_t                    Actual;    /*!< Rate actually programmed     */
+    int32_t                     ErrorPPM;  /*!< (Actual - Rate) / Rate, ppm  */
+} UARTAutoBaud_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup UARTAutoBaud_Functions UART Auto-Baud Exported Functions
+  * @{
+  */
+
+/** @brief  Start waiting for the host's character to measure its baud rate
+  *
+  * @param  [out] AB       Auto-baud state to initialize
+  * @param  [in]  Uart     The UART to measure
+  * @param  [in]  Mode     Measurement mode (UART_AutoBaudMode_0 for 'A'/'a')
+  * @param  [in]  Done     Called (from the ISR) once locked; may be NULL
+  *
+  * @return None.
+  *
+  * Enables the UART's auto-baud interrupts; the VIC slot should already be
+  *  set up.  Timeouts restart the measurement automatically, so detection
+  *  runs until a rate is found or it's stopped.  The word length / parity /
+  *  stop bits are left as they are.
+  */
+void UARTAutoBaud_Start(UARTAutoBaud_Type *AB, UART_Type *Uart,
+                        UART_AutoBaudMode_Type Mode,
+                        UARTAutoBaud_Callback_Type Done);
+
+/** @brief  Abandon a running auto-baud detection
+  *
+  * @param  [in]  AB       Auto-baud state
+  *
+  * @return None.
+  */
+void UARTAutoBaud_Stop(UARTAutoBaud_Type *AB);
+
+/** @brief  Service the UART's auto-baud interrupts
+  *
+  * @param  [in]  AB       Auto-baud state for the interrupting UART
+  *
+  * @return None.
+  *
+  * Doesn't read IIR, so other UART interrupts are left pending for whoever
+  *  else services the UART.  Does NOT acknowledge the VIC.
+  */
+void UARTAutoBaud_IRQHandler(UARTAutoBaud_Type *AB);
+
+/**
+  * @}
+  */
+
+
+/* Inline Functions ---------------------------------------------------------*/
+
+/** @defgroup UARTAutoBaud_Inline_Functions
+  * @{
+  */
+
+/** @brief  Determine Whether a Rate Has Been Found
+  * @param  AB      Auto-baud state
+  * @return 1 if locked, 0 otherwise
+  */
+__INLINE static uint8_t UARTAutoBaud_IsLocked(UARTAutoBaud_Type *AB)
+{
+    return (AB->State == UARTAutoBaud_State_Locked) ? 1:0;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_UART_AUTOBAUD_H_ */
@@ -0,0 +1,470 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart_buffered.h
+ * @purpose: Header File for Interrupt-Driven, Ring Buffered UART IO
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - Line settings (divisor, word length, etc.) and pin / power setup are
+ *   still done through LPC2xxx_uart.h; this layer only moves the data.
+ *
+ * - The VIC routing is left to the application.  Its UART IRQ handler
+ *   should call UARTBuf_IRQHandler() and then VIC_IRQDone().
+ *
+ * - Each interrupt empties the whole Rx FIFO or refills the whole (16 byte)
+ *   Tx FIFO, so there is one IRQ per FIFO load rather than one per byte.
+ *
+ * - On UART1, UARTBuf_EnableFlowControl() adds RTS / CTS backpressure:
+ *   once the Rx ring reaches its high watermark the ISR stops emptying the
+ *   Rx FIFO, the FIFO fills to its trigger level and auto-RTS holds off the
+ *   sender.  Reading the ring down to the low watermark lets data flow
+ *   again.  Nothing is dropped no matter how long the reader stalls.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_UART_BUFFERED_H_
+#define LPC2XXX_UART_BUFFERED_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart.h"
+#include "LPC2xxx_vic.h"
+
+
+/** @addtogroup UARTBuf Buffered UART Interface
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup UARTBuf_Defines
+  * @{
+  */
+
+/*! @brief Check that a ring buffer size is a non-zero power of two <= 32768 */
+#define UARTBUF_IS_RING_SIZE(Size) (((Size) != 0) && ((Size) <= 32768) \
+                                 && (((Size) & ((Size) - 1)) == 0))
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup UARTBuf_Types
+  * @{
+  */
+
+/*! @brief One piece of a scatter-gather transmit (see UARTBuf_SendV) */
+typedef struct {
+    const void        *Data;       /*!< Start of the bytes to send           */
+    uint16_t           Len;        /*!< Number of bytes to send              */
+} UARTBuf_Segment_Type;
+
+/*! @brief Completion callback; called from the UART's ISR */
+typedef void (*UARTBuf_Callback_Type)(void *Arg);
+
+/*! @brief Receive sink; called from the UART's ISR with each Rx FIFO burst */
+typedef void (*UARTBuf_RxSink_Type)(void *Arg, const uint8_t *Data, uint16_t Len);
+
+/*! @brief Receive health counters for one buffered UART.
+  *
+  * RxFifoHighWater is the most bytes found waiting when the Rx interrupt
+  *  was serviced, counted until the FIFO first ran dry and capped at
+  *  UART_RxFifoSize.  A byte arriving mid-drain may add one; a value of
+  *  UART_RxFifoSize means the FIFO was (about) full, i.e. at or past the
+  *  point of overrunning.
+  */
+typedef struct {
+    uint32_t   Overruns;           /*!< Rx FIFO overruns                  */
+    uint32_t   ParityErrors;       /*!< Bytes with bad parity             */
+    uint32_t   FramingErrors;      /*!< Bytes with a bad stop bit         */
+    uint32_t   Breaks;             /*!< Break conditions seen             */
+    uint16_t   RxRingHighWater;    /*!< Most bytes held in the Rx ring    */
+    uint8_t    RxFifoHighWater;    /*!< Most bytes in the Rx FIFO at once
+                                        (<= UART_RxFifoSize)               */
+} UARTBuf_Stats_Type;
+
+/*! @brief State for one interrupt-driven, ring buffered UART.
+  *
+  * Head / Tail indices run freely and are masked on access; the ISR is the
+  *  only writer of RxHead / TxTail and the application the only writer of
+  *  RxTail / TxHead, so no locking is needed to move data.
+  */
+typedef struct {
+    UART_Type             *Uart;         /*!< UART being serviced                */
+    IRQn_Type              IRQn;         /*!< The UART's IRQ number in the VIC   */
+
+    uint8_t               *RxBuf;        /*!< Receive ring storage               */
+    uint16_t               RxMask;       /*!< Receive ring size - 1              */
+    volatile uint16_t      RxHead;       /*!< Next Rx slot to fill (ISR)         */
+    volatile uint16_t      RxTail;       /*!< Next Rx slot to read (application) */
+    UARTBuf_RxSink_Type    RxSink;       /*!< Takes Rx data instead of the ring  */
+    void                  *RxSinkArg;    /*!< Argument for RxSink                */
+
+    uint8_t               *TxBuf;        /*!< Transmit ring storage              */
+    uint16_t               TxMask;       /*!< Transmit ring size - 1             */
+    volatile uint16_t      TxHead;       /*!< Next Tx slot to fill (application) */
+    volatile uint16_t      TxTail;       /*!< Next Tx slot to send (ISR)         */
+
+    const UARTBuf_Segment_Type * volatile TxSeg; /*!< Current SendV segment
+                                                   (NULL when none running) */
+    const uint8_t         *TxSegData;    /*!< Next byte of the current segment   */
+    uint16_t               TxSegLen;     /*!< Bytes left in current segment      */
+    uint16_t               TxSegMark;    /*!< Tx ring index SendV data follows   */
+    uint8_t                TxSegsLeft;   /*!< SendV segments left, incl. current */
+    UARTBuf_Callback_Type  TxSegDone;    /*!< SendV completion callback          */
+    void                  *TxSegDoneArg; /*!< Argument for TxSegDone             */
+    UARTBuf_Callback_Type  TxStartHook;  /*!< Called as an idle Tx starts        */
+    UARTBuf_Callback_Type  TxIdleHook;   /*!< Called once the Tx FIFO runs dry   */
+    void                  *TxHookArg;    /*!< Argument for the Tx hooks          */
+
+    uint16_t               RxHighWater;  /*!< Rx fill that throttles (0 = off)   */
+    uint16_t               RxLowWater;   /*!< Rx fill that unthrottles           */
+    volatile uint8_t       RxThrottled;  /*!< Rx FIFO left full for auto-RTS     */
+
+    volatile uint8_t       LineStatus;   /*!< Accumulated Rx line error bits     */
+    volatile uint32_t      RxDropped;    /*!< Bytes lost because ring was full   */
+    UARTBuf_Stats_Type     Stats;        /*!< Rx health (see UARTBuf_GetStats)   */
+} UARTBuf_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup UARTBuf_Functions Buffered UART Exported Functions
+  * @{
+  */
+
+/** @brief  Attach ring buffers to a UART and start interrupt-driven IO
+  *
+  * @param  [out] UB       Buffered UART state to initialize
+  * @param  [in]  Uart     The UART to service
+  * @param  [in]  IRQn     The UART's IRQ number (e.g. UART0_IRQn)
+  * @param  [in]  RxBuf    Receive ring storage
+  * @param  [in]  RxSize   Size of RxBuf (power of 2)
+  * @param  [in]  TxBuf    Transmit ring storage
+  * @param  [in]  TxSize   Size of TxBuf (power of 2)
+  * @param  [in]  Trigger  Rx FIFO level at which to interrupt
+  *
+  * @return None.
+  *
+  * Flushes the FIFOs and enables the Rx data / line status interrupts on
+  *  the UART.  The VIC slot for the UART should be set up by the caller.
+  *  With high baud rates, UART_RxFifoTrigger_8 leaves a good balance of
+  *  IRQ rate vs. latency margin; stragglers are picked up by the character
+  *  timeout interrupt.
+  */
+void UARTBuf_Init(UARTBuf_Type *UB, UART_Type *Uart, IRQn_Type IRQn,
+                  uint8_t *RxBuf, uint16_t RxSize,
+                  uint8_t *TxBuf, uint16_t TxSize,
+                  UART_RxFifoTrigger_Type Trigger);
+
+/** @brief  Queue data for transmission
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [in]  Data     Bytes to send
+  * @param  [in]  Len      Number of bytes to send
+  *
+  * @return Number of bytes queued (less than Len if the Tx ring filled up).
+  *
+  * Does not block.  Starts the transmitter if it was idle.
+  */
+uint16_t UARTBuf_Write(UARTBuf_Type *UB, const uint8_t *Data, uint16_t Len);
+
+/** @brief  Queue data for transmission, waiting for room as needed
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [in]  Data     Bytes to send
+  * @param  [in]  Len      Number of bytes to send
+  *
+  * @return None.
+  *
+  * Blocks until everything is in the Tx ring; must not be called from an
+  *  ISR.  UARTBuf_Write() is the non-blocking form.
+  */
+void UARTBuf_WriteAll(UARTBuf_Type *UB, const uint8_t *Data, uint16_t Len);
+
+/** @brief  Publish bytes written straight into the Tx ring
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [in]  Head     New Tx ring head (one past the last byte written)
+  *
+  * @return None.
+  *
+  * For producers that fill TxBuf in place (e.g. LPC2xxx_uart_printf.h)
+  *  rather than going through UARTBuf_Write().  Starts the transmitter if
+  *  it was idle.
+  */
+void UARTBuf_CommitTx(UARTBuf_Type *UB, uint16_t Head);
+
+/** @brief  Transmit a list of buffers without copying them
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [in]  Segs     Buffers to send, in order
+  * @param  [in]  Count    Number of entries in Segs (at least 1)
+  * @param  [in]  Done     Called (from the ISR) once the last byte is in the
+  *                         Tx FIFO; may be NULL
+  * @param  [in]  Arg      Passed to Done
+  *
+  * @return 1 if the transfer was started, 0 if one is already in progress.
+  *
+  * The bytes are fed from the caller's buffers straight into the Tx FIFO,
+  *  a FIFO load per THRE interrupt.  Segs and the buffers it points to must
+  *  stay untouched until Done is called.  Data already in the Tx ring goes
+  *  out first; data written with UARTBuf_Write() afterwards waits until the
+  *  whole list has been sent, so frames are never split up.
+  */
+uint8_t UARTBuf_SendV(UARTBuf_Type *UB, const UARTBuf_Segment_Type *Segs,
+                      uint8_t Count, UARTBuf_Callback_Type Done, void *Arg);
+
+/** @brief  Retrieve received data
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [out] Data     Where to store received bytes
+  * @param  [in]  Len      Maximum number of bytes to retrieve
+  *
+  * @return Number of bytes retrieved (0 if none were waiting).
+  */
+uint16_t UARTBuf_Read(UARTBuf_Type *UB, uint8_t *Data, uint16_t Len);
+
+/** @brief  Turn on RTS / CTS flow control with Rx ring watermarks
+  *
+  * @param  [in]  UB        Buffered UART state (UART1 only)
+  * @param  [in]  HighWater Rx ring fill at which the sender is held off
+  * @param  [in]  LowWater  Rx ring fill at which it's let go again
+  *
+  * @return None.
+  *
+  * Enables the UART's auto-RTS and auto-CTS.  RTS drops when the Rx FIFO
+  *  reaches its trigger level, so the trigger should leave room for the
+  *  byte or two a sender may still get out; UART_RxFifoTrigger_8 is a good
+  *  choice.  HighWater may be as large as the Rx ring, and LowWater must be
+  *  less than HighWater.  Has no effect on data going to an Rx sink.
+  */
+void UARTBuf_EnableFlowControl(UARTBuf_Type *UB, uint16_t HighWater, uint16_t LowWater);
+
+/** @brief  Turn off RTS / CTS flow control
+  *
+  * @param  [in]  UB       Buffered UART state
+  *
+  * @return None.
+  */
+void UARTBuf_DisableFlowControl(UARTBuf_Type *UB);
+
+/** @brief  Service a UART interrupt
+  *
+  * @param  [in]  UB       Buffered UART state for the interrupting UART
+  *
+  * @return None.
+  *
+  * To be called from the UART's IRQ handler.  Handles every pending
+  *  interrupt ID before returning; does NOT acknowledge the VIC.
+  */
+void UARTBuf_IRQHandler(UARTBuf_Type *UB);
+
+/**
+  * @}
+  */
+
+
+/* Inline Functions ---------------------------------------------------------*/
+
+/** @defgroup UARTBuf_Inline_Functions
+  * @{
+  */
+
+/** @brief  Get the Number of Received Bytes Waiting in the Rx Ring
+  * @param  UB      Buffered UART state
+  * @return Number of bytes that can be read
+  */
+__INLINE static uint16_t UARTBuf_RxAvailable(UARTBuf_Type *UB)
+{
+    return (uint16_t)(UB->RxHead - UB->RxTail);
+}
+
+/** @brief  Get the Free Space in the Tx Ring
+  * @param  UB      Buffered UART state
+  * @return Number of bytes that can be queued without blocking
+  */
+__INLINE static uint16_t UARTBuf_TxFree(UARTBuf_Type *UB)
+{
+    return (uint16_t)(UB->TxMask + 1 - (uint16_t)(UB->TxHead - UB->TxTail));
+}
+
+/** @brief  Determine Whether a Scatter-Gather Transmit is in Progress
+  * @param  UB      Buffered UART state
+  * @return 1 if a UARTBuf_SendV() transfer hasn't finished, 0 otherwise
+  */
+__INLINE static uint8_t UARTBuf_SendVIsBusy(UARTBuf_Type *UB)
+{
+    return (UB->TxSeg != 0) ? 1:0;
+}
+
+/** @brief  Determine Whether All Queued Tx Data has Been Handed to the UART
+  * @param  UB      Buffered UART state
+  * @return 1 if the Tx ring is empty and no SendV is running, 0 otherwise
+  */
+__INLINE static uint8_t UARTBuf_TxIsEmpty(UARTBuf_Type *UB)
+{
+    return ((UB->TxHead == UB->TxTail) && (UB->TxSeg == 0)) ? 1:0;
+}
+
+/** @brief  Divert Received Data to a Sink Instead of the Rx Ring
+  * @param  UB      Buffered UART state
+  * @param  Sink    Called from the ISR once per Rx FIFO burst (0 = use ring)
+  * @param  Arg     Passed to Sink
+  * @return None.
+  *
+  * E.g. UARTBuf_SetRxSink(&ub, UARTFramer_RxSink, &framer) to frame
+  *  packets straight out of the FIFO (see LPC2xxx_uart_framer.h).
+  */
+__INLINE static void UARTBuf_SetRxSink(UARTBuf_Type *UB, UARTBuf_RxSink_Type Sink, void *Arg)
+{
+    VIC_DisableIRQ(UB->IRQn);
+    UB->RxSinkArg = Arg;
+    UB->RxSink = Sink;
+    VIC_EnableIRQ(UB->IRQn);
+}
+
+/** @brief  Determine Whether the Sender is Being Held Off
+  * @param  UB      Buffered UART state
+  * @return 1 if the Rx ring is over its high watermark, 0 otherwise
+  */
+__INLINE static uint8_t UARTBuf_RxIsThrottled(UARTBuf_Type *UB)
+{
+    return UB->RxThrottled;
+}
+
+/** @brief  Zero the Receive Health Counters
+  * @param  UB      Buffered UART state
+  * @return None.
+  */
+__INLINE static void UARTBuf_ClearStats(UARTBuf_Type *UB)
+{
+    VIC_DisableIRQ(UB->IRQn);
+    UB->Stats.Overruns        = 0;
+    UB->Stats.ParityErrors    = 0;
+    UB->Stats.FramingErrors   = 0;
+    UB->Stats.Breaks          = 0;
+    UB->Stats.RxRingHighWater = 0;
+    UB->Stats.RxFifoHighWater = 0;
+    VIC_EnableIRQ(UB->IRQn);
+}
+
+/** @brief  Get a Consistent Copy of the Receive Health Counters
+  * @param  UB      Buffered UART state
+  * @param  Stats   Where to put the counters
+  * @param  Clear   Non-zero to zero the counters afterwards
+  * @return None.
+  */
+__INLINE static void UARTBuf_GetStats(UARTBuf_Type *UB, UARTBuf_Stats_Type *Stats,
+                                      uint8_t Clear)
+{
+    VIC_DisableIRQ(UB->IRQn);
+    *Stats = UB->Stats;
+    if (Clear) {
+        UB->Stats.Overruns        = 0;
+        UB->Stats.ParityErrors    = 0;
+        UB->Stats.FramingErrors   = 0;
+        UB->Stats.Breaks          = 0;
+        UB->Stats.RxRingHighWater = 0;
+        UB->Stats.RxFifoHighWater = 0;
+    }
+    VIC_EnableIRQ(UB->IRQn);
+}
+
+/** @brief  Set Callbacks for Transmitter Start / Idle
+  * @param  UB      Buffered UART state
+  * @param  Start   Called just before an idle transmitter is given data
+  * @param  Idle    Called from the ISR once the Tx FIFO has run dry and
+  *                  there's nothing left to send (the last byte is still in
+  *                  the shift register)
+  * @param  Arg     Passed to Start and Idle
+  * @return None.
+  *
+  * E.g. UARTBuf_SetTxHooks(&ub, UARTRS485_TxStart, UARTRS485_TxIdle, &rs485)
+  *  to drive an RS-485 transceiver (see LPC2xxx_uart_rs485.h).  Start is
+  *  called with the UART's IRQ held off.
+  */
+__INLINE static void UARTBuf_SetTxHooks(UARTBuf_Type *UB, UARTBuf_Callback_Type Start,
+                                        UARTBuf_Callback_Type Idle, void *Arg)
+{
+    VIC_DisableIRQ(UB->IRQn);
+    UB->TxHookArg   = Arg;
+    UB->TxStartHook = Start;
+    UB->TxIdleHook  = Idle;
+    VIC_EnableIRQ(UB->IRQn);
+}
+
+/** @brief  Get and Clear the Accumulated Rx Line Error Bits
+  * @param  UB      Buffered UART state
+  * @return ORed UART_LineStatus_* error bits seen since the last call
+  */
+__INLINE static uint8_t UARTBuf_GetLineErrors(UARTBuf_Type *UB)
+{
+    uint8_t Errors;
+
+
+    VIC_DisableIRQ(UB->IRQn);
+    Errors = UB->LineStatus;
+    UB->LineStatus = 0;
+    VIC_EnableIRQ(UB->IRQn);
+
+    return Errors;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_UART_BUFFERED_H_ */
@@ -0,0 +1,142 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart_dispatch.h
+ * @purpose: Header File for a Shared, Table-Driven Buffered UART IRQ Handler
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - One handler, UARTDispatch_IRQHandler(), services every attached port,
+ *   so there's no per-UART handler to write.  It can sit in a vectored
+ *   slot per port or once as the default (non-vectored) handler.
+ *
+ * - Each port's receive health (overruns, parity / framing errors, breaks,
+ *   Rx FIFO and ring high-water marks) is kept by the buffered UART layer
+ *   and can be read by port number with UARTDispatch_GetStats().
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_UART_DISPATCH_H_
+#define LPC2XXX_UART_DISPATCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart_buffered.h"
+
+
+/** @addtogroup UARTDispatch Shared UART IRQ Dispatcher
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup UARTDispatch_Defines
+  * @{
+  */
+
+#ifndef UARTDISPATCH_MAX_PORTS
+#define UARTDISPATCH_MAX_PORTS  (2)     /*!< Number of port table entries   */
+#endif
+
+#define UARTDISPATCH_SLOT_DEFAULT (0xff) /*!< Use the non-vectored handler  */
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup UARTDispatch_Functions UART Dispatcher Exported Functions
+  * @{
+  */
+
+/** @brief  Add a buffered UART to the dispatch table and route its IRQ
+  *
+  * @param  [in]  Port     Table index to use (e.g. 0 for UART0)
+  * @param  [in]  UB       Buffered UART state (already initialized)
+  * @param  [in]  Slot     VIC slot for the UART's IRQ, or
+  *                         UARTDISPATCH_SLOT_DEFAULT to be the VIC's default
+  *                         handler
+  *
+  * @return None.
+  */
+void UARTDispatch_Attach(uint8_t Port, UARTBuf_Type *UB, uint8_t Slot);
+
+/** @brief  Remove a port from the dispatch table
+  *
+  * @param  [in]  Port     Table index
+  *
+  * @return None.
+  *
+  * The port's VIC slot / interrupt are left alone.
+  */
+void UARTDispatch_Detach(uint8_t Port);
+
+/** @brief  Service all attached UARTs with a pending interrupt
+  *
+  * @return None.
+  *
+  * An IRQ handler in its own right; acknowledges the VIC on the way out.
+  */
+void UARTDispatch_IRQHandler(void);
+
+/** @brief  Get a port's receive health counters
+  *
+  * @param  [in]  Port     Table index
+  * @param  [out] Stats    Where to put the counters
+  * @param  [in]  Clear    Non-zero to zero the counters afterwards
+  *
+  * @return 1 on success, 0 if nothing is attached at Port.
+  */
+uint8_t UARTDispatch_GetStats(uint8_t Port, UARTBuf_Stats_Type *Stats, uint8_t Clear);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_UART_DISPATCH_H_ */
@@ -0,0 +1,234 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart_framer.h
+ * @purpose: Header File for In-ISR COBS / SLIP Packet Framing of UART Data
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - Frames are decoded as the bytes come out of the Rx FIFO, directly into
+ *   a pool of packet buffers; the application gets a pointer to each whole
+ *   frame and releases it when done.  Nothing is copied after decoding.
+ *
+ * - Usually fed by the buffered UART layer:
+ *     UARTBuf_SetRxSink(&ub, UARTFramer_RxSink, &framer);
+ *
+ * - Frames that are too long, badly encoded, or that arrive while the pool
+ *   is full are dropped whole (and counted).
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_UART_FRAMER_H_
+#define LPC2XXX_UART_FRAMER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+
+
+/** @addtogroup UARTFramer UART Packet Framer
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup UARTFramer_Defines
+  * @{
+  */
+
+#define UARTFRAMER_SLIP_END      (0xc0)  /*!< SLIP frame delimiter          */
+#define UARTFRAMER_SLIP_ESC      (0xdb)  /*!< SLIP escape                   */
+#define UARTFRAMER_SLIP_ESC_END  (0xdc)  /*!< Escaped SLIP_END              */
+#define UARTFRAMER_SLIP_ESC_ESC  (0xdd)  /*!< Escaped SLIP_ESC              */
+
+#define UARTFRAMER_COBS_END      (0x00)  /*!< COBS frame delimiter          */
+
+/*! @brief Bytes of pool needed for Count packets of up to Size bytes each */
+#define UARTFRAMER_POOL_SIZE(Count, Size) ((Count) * ((Size) + 2))
+
+/*! @brief Check that a packet count is a power of two <= 128 */
+#define UARTFRAMER_IS_PACKET_COUNT(Count) (((Count) != 0) && ((Count) <= 128) \
+                                        && (((Count) & ((Count) - 1)) == 0))
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup UARTFramer_Types
+  * @{
+  */
+
+/*! @brief Framing to decode */
+typedef enum {
+    UARTFramer_Mode_SLIP = 0,      /*!< RFC 1055 SLIP                        */
+    UARTFramer_Mode_COBS,          /*!< Consistent Overhead Byte Stuffing    */
+} UARTFramer_Mode_Type;
+#define UARTFRAMER_IS_MODE(MODE) (((MODE) == UARTFramer_Mode_SLIP) \
+                               || ((MODE) == UARTFramer_Mode_COBS))
+
+/*! @brief State for one packet framer.
+  *
+  * Each pool slot holds a 2 byte length followed by the packet.  Slots are
+  *  filled (by the ISR) and released (by the application) in order.
+  */
+typedef struct {
+    uint8_t               *Pool;       /*!< Packet slots                      */
+    uint16_t               SlotSize;   /*!< Bytes per slot (PacketSize + 2)   */
+    uint16_t               PacketSize; /*!< Largest packet accepted           */
+    uint8_t                SlotMask;   /*!< Number of slots - 1               */
+    volatile uint8_t       Head;       /*!< Slot being filled (ISR)           */
+    volatile uint8_t       Tail;       /*!< Oldest unreleased slot (app)      */
+
+    UARTFramer_Mode_Type   Mode;       /*!< SLIP or COBS                      */
+    uint16_t               Len;        /*!< Bytes decoded into current frame  */
+    uint8_t                Escape;     /*!< SLIP: last byte was SLIP_ESC      */
+    uint8_t                Left;       /*!< COBS: bytes left in this block    */
+    uint8_t                Zero;       /*!< COBS: zero due before next block  */
+    uint8_t                Discard;    /*!< Dropping the rest of this frame   */
+
+    volatile uint32_t      Frames;     /*!< Frames delivered                  */
+    volatile uint32_t      Dropped;    /*!< Frames lost: pool was full        */
+    volatile uint32_t      Errors;     /*!< Frames lost: too long / bad code  */
+} UARTFramer_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup UARTFramer_Functions UART Packet Framer Exported Functions
+  * @{
+  */
+
+/** @brief  Set up a packet framer
+  *
+  * @param  [out] F           Framer state to initialize
+  * @param  [in]  Mode        Framing to decode
+  * @param  [in]  Pool        Packet storage, UARTFRAMER_POOL_SIZE() bytes
+  * @param  [in]  NumPackets  Number of packet slots (power of 2, <= 128)
+  * @param  [in]  PacketSize  Largest decoded packet to accept
+  *
+  * @return None.
+  */
+void UARTFramer_Init(UARTFramer_Type *F, UARTFramer_Mode_Type Mode,
+                     uint8_t *Pool, uint8_t NumPackets, uint16_t PacketSize);
+
+/** @brief  Decode received bytes
+  *
+  * @param  [in]  F        Framer state
+  * @param  [in]  Data     Received (encoded) bytes
+  * @param  [in]  Len      Number of bytes
+  *
+  * @return None.
+  *
+  * Meant to be called from the UART ISR with each FIFO burst.
+  */
+void UARTFramer_Feed(UARTFramer_Type *F, const uint8_t *Data, uint16_t Len);
+
+/** @brief  UARTFramer_Feed() in the form of a UARTBuf_RxSink_Type
+  *
+  * @param  [in]  Arg      The UARTFramer_Type to feed
+  * @param  [in]  Data     Received (encoded) bytes
+  * @param  [in]  Len      Number of bytes
+  *
+  * @return None.
+  */
+void UARTFramer_RxSink(void *Arg, const uint8_t *Data, uint16_t Len);
+
+/**
+  * @}
+  */
+
+
+/* Inline Functions ---------------------------------------------------------*/
+
+/** @defgroup UARTFramer_Inline_Functions
+  * @{
+  */
+
+/** @brief  Get the Oldest Received Packet
+  * @param  F       Framer state
+  * @param  Len     Where to store the packet's length
+  * @return Pointer to the packet, or 0 if none are waiting
+  *
+  * The packet stays valid until UARTFramer_ReleasePacket() is called.
+  */
+__INLINE static uint8_t *UARTFramer_GetPacket(UARTFramer_Type *F, uint16_t *Len)
+{
+    uint8_t *Slot;
+
+
+    if (F->Head == F->Tail) {
+        return 0;
+    }
+
+    Slot = F->Pool + (F->Tail & F->SlotMask) * F->SlotSize;
+    *Len = Slot[0] | (Slot[1] << 8);
+
+    return Slot + 2;
+}
+
+/** @brief  Give the Oldest Received Packet's Slot Back to the Framer
+  * @param  F       Framer state
+  * @return None.
+  */
+__INLINE static void UARTFramer_ReleasePacket(UARTFramer_Type *F)
+{
+    if (F->Head != F->Tail) {
+        F->Tail++;
+    }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_UART_FRAMER_H_ */
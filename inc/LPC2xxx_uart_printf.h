@@ -0,0 +1,131 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart_printf.h
+ * @purpose: Header File for Compact Formatted Output to a Buffered UART
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - Characters are rendered one at a time straight into the UART's Tx
+ *   ring (see LPC2xxx_uart_buffered.h); there's no output buffer, no
+ *   malloc and no floating point.
+ *
+ * - Conversions: %d %i %u %x %X %c %s %% and %q, which prints an integer
+ *   as fixed-point with the precision giving the number of digits after
+ *   the point (e.g. "%.3q" with 12345 prints 12.345).  'l' and 'h' length
+ *   modifiers are accepted and ignored (long is int-sized here).
+ *
+ * - Field widths, '-' / '0' flags, '*' and %s precision are only compiled
+ *   in if UARTPRINTF_WIDTH is defined non-zero when building the library.
+ *   Without them they are still parsed (and a '*' still takes its int
+ *   argument) but have no effect, so the same formats work either way.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_UART_PRINTF_H_
+#define LPC2XXX_UART_PRINTF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdarg.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart_buffered.h"
+
+
+/** @addtogroup UARTPrintf UART Formatted Output
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup UARTPrintf_Defines
+  * @{
+  */
+
+#ifndef UARTPRINTF_WIDTH
+#define UARTPRINTF_WIDTH 0    /*!< Non-zero to support widths / flags      */
+#endif
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup UARTPrintf_Functions UART Formatted Output Exported Functions
+  * @{
+  */
+
+/** @brief  Format text into a buffered UART's Tx ring
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [in]  Fmt      printf-style format: %d %i %u %x %X %c %s %%
+  *                         and %q (fixed-point, precision = digits after
+  *                         the point)
+  * @param  [in]  Args     Arguments for the format
+  *
+  * @return Number of characters written.
+  *
+  * Waits for room whenever the Tx ring fills, so must not be called from
+  *  an ISR (or with the UART's IRQ disabled).
+  */
+int UARTBuf_VPrintf(UARTBuf_Type *UB, const char *Fmt, va_list Args);
+
+/** @brief  Format text into a buffered UART's Tx ring
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [in]  Fmt      printf-style format, as for UARTBuf_VPrintf()
+  *
+  * @return Number of characters written.
+  */
+int UARTBuf_Printf(UARTBuf_Type *UB, const char *Fmt, ...);
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_UART_PRINTF_H_ */
@@ -0,0 +1,206 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart_rs485.h
+ * @purpose: Header File for RS-485 Half-Duplex Driver Enable Control
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - The transceiver's DE (and /RE, if tied to it) is driven from a GPIO
+ *   pin.  DE goes up just before an idle transmitter is given data, and
+ *   comes down from a TIMER match interrupt one bit-time after the last
+ *   stop bit; nothing waits on TEMT in a loop.
+ *
+ * - The UART's THRE interrupt marks the last byte moving into the shift
+ *   register, so the match is armed there for a character plus a bit
+ *   time.  TEMT is checked when it fires in case the interrupt was late.
+ *
+ * - Receive interrupts are held off while driving the bus, and anything
+ *   that arrived meanwhile (our own echo, or noise from a floating RO) is
+ *   thrown away when the bus is released.
+ *
+ * - Usually hooked into the buffered UART layer:
+ *     UARTBuf_SetTxHooks(&ub, UARTRS485_TxStart, UARTRS485_TxIdle, &rs485);
+ *   The TIMER's IRQ handler should call UARTRS485_TimerIRQHandler(), then
+ *   VIC_IRQDone().
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_UART_RS485_H_
+#define LPC2XXX_UART_RS485_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart.h"
+#include "LPC2xxx_timer.h"
+#include "LPC2xxx_gpio.h"
+
+
+/** @addtogroup UARTRS485 UART RS-485 Half-Duplex Control
+  * @{
+  */
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup UARTRS485_Types
+  * @{
+  */
+
+/*! @brief Who has the bus */
+typedef enum {
+    UARTRS485_State_Rx = 0,        /*!< DE off, listening                    */
+    UARTRS485_State_Tx,            /*!< DE on, transmitter running           */
+    UARTRS485_State_Turnaround,    /*!< Last byte going out; timer running   */
+} UARTRS485_State_Type;
+
+/*! @brief State for one RS-485 transceiver */
+typedef struct {
+    UART_Type                     *Uart;         /*!< UART driving transceiver   */
+    TIMER_Type                    *Timer;        /*!< Timer for turnaround (MR0) */
+    IRQn_Type                      TimerIRQn;    /*!< The timer's IRQ number     */
+    GPIO_Type                     *GPIO;         /*!< Port with the DE pin       */
+    uint32_t                       DEPin;        /*!< DE pin (GPIO_Pin_x)        */
+
+    uint32_t                       BitTicks;     /*!< One bit time in PCLKs      */
+    uint32_t                       IdleTicks;    /*!< THRE to DE off, in PCLKs   */
+    uint16_t                       RxIT;         /*!< Rx interrupts to restore   */
+
+    volatile UARTRS485_State_Type  State;        /*!< Current direction          */
+    volatile uint32_t              Turnarounds;  /*!< Times the bus was released */
+    volatile uint32_t              Late;         /*!< Times TEMT wasn't set yet  */
+} UARTRS485_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup UARTRS485_Functions UART RS-485 Exported Functions
+  * @{
+  */
+
+/** @brief  Set up RS-485 direction control, starting out receiving
+  *
+  * @param  [out] RS        RS-485 state to initialize
+  * @param  [in]  Uart      UART driving the transceiver (line settings done)
+  * @param  [in]  Timer     Timer to use for the turnaround (MR0)
+  * @param  [in]  TimerIRQn The timer's IRQ number (e.g. TIM1_IRQn)
+  * @param  [in]  GPIO      Port with the DE pin
+  * @param  [in]  DEPin     DE pin (GPIO_Pin_x, active high)
+  * @param  [in]  Baud      The UART's baud rate
+  *
+  * @return None.
+  *
+  * The word length, parity and stop bits are read from the UART to work
+  *  out the character time, so should be set beforehand.  The timer's VIC
+  *  slot should be set up by the caller.
+  */
+void UARTRS485_Init(UARTRS485_Type *RS, UART_Type *Uart,
+                    TIMER_Type *Timer, IRQn_Type TimerIRQn,
+                    GPIO_Type *GPIO, uint32_t DEPin, uint32_t Baud);
+
+/** @brief  Take the bus before transmitting
+  *
+  * @param  [in]  Arg      The UARTRS485_Type
+  *
+  * @return None.
+  *
+  * A UARTBuf_Callback_Type; called with the UART's IRQ held off, before the
+  *  first byte goes into the Tx FIFO.  Cancels a pending turnaround if the
+  *  transmitter is restarted before the bus was released.
+  */
+void UARTRS485_TxStart(void *Arg);
+
+/** @brief  Schedule releasing the bus after the last byte
+  *
+  * @param  [in]  Arg      The UARTRS485_Type
+  *
+  * @return None.
+  *
+  * A UARTBuf_Callback_Type; called from the UART's THRE interrupt once
+  *  there's nothing left to load into the Tx FIFO.
+  */
+void UARTRS485_TxIdle(void *Arg);
+
+/** @brief  Service the turnaround timer's interrupt
+  *
+  * @param  [in]  RS       RS-485 state
+  *
+  * @return None.
+  *
+  * Drops DE, throws away anything received while transmitting and turns
+  *  the Rx interrupts back on.  Does NOT acknowledge the VIC.
+  */
+void UARTRS485_TimerIRQHandler(UARTRS485_Type *RS);
+
+/**
+  * @}
+  */
+
+
+/* Inline Functions ---------------------------------------------------------*/
+
+/** @defgroup UARTRS485_Inline_Functions
+  * @{
+  */
+
+/** @brief  Determine Whether the Bus is Being Driven
+  * @param  RS      RS-485 state
+  * @return 1 if DE is on (transmitting or turning around), 0 otherwise
+  */
+__INLINE static uint8_t UARTRS485_IsDriving(UARTRS485_Type *RS)
+{
+    return (RS->State != UARTRS485_State_Rx) ? 1:0;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_UART_RS485_H_ */
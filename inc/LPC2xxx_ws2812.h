@@ -0,0 +1,250 @@
+/******************************************************************************
+ * @file:    LPC2xxx_ws2812.h
+ * @purpose: Header File for Driving WS2812 / SK6812 LED Strips From an SSP
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - Each LED data bit is sent as a group of SSP bits, high then low, at a
+ *   few MHz, so MOSI reproduces the strip's bit timing; a pixel byte is two
+ *   SSP frames, one per nibble, taken from a 16 entry lookup table.  The
+ *   FIFO is refilled from the Tx half-empty interrupt, so the CPU only
+ *   does a table lookup per 4 LED bits.
+ *
+ * - The pattern (3 or 4 SSP bits per LED bit) and SCK rate are picked at
+ *   compile time from WS2812_PCLK, which defaults to F_CPU over the APB
+ *   divider (APBCLKDIV_Val, or system_LPC2xxx.c's default of 4).  If the
+ *   application changes the APB divider at run time, WS2812_PCLK has to be
+ *   defined to match when building the library; WS2812_Init() asserts
+ *   that it does.
+ *
+ * - If no SCK rate that PCLK can make fits the strip's timing (e.g. a 12MHz
+ *   F_CPU with the APB divider at 4), WS2812_AVAILABLE isn't defined and
+ *   the driver builds to nothing.
+ *
+ * - Pixel data goes out as stored, so it should be in the strip's wire
+ *   order (GRB for WS2812, GRBW for SK6812 RGBW).  A latch (reset) gap of
+ *   all-zero frames follows each refresh.
+ *
+ * - The SSP (and its MOSI pin) is given over to the strip.  Pin / power
+ *   setup and the SSP's VIC routing are left to the application; its SSP
+ *   IRQ handler should call WS2812_IRQHandler(), then VIC_IRQDone().  A
+ *   half FIFO of frames (16us or so) covers the IRQ latency.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+#ifndef LPC2XXX_WS2812_H_
+#define LPC2XXX_WS2812_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include "LPC2xxx.h"
+#include "LPC2xxx_ssp.h"
+
+
+/** @addtogroup WS2812 WS2812 / SK6812 LED Strip
+  * @{
+  */
+
+/* Defines ------------------------------------------------------------------*/
+
+/** @defgroup WS2812_Defines
+  * @{
+  */
+
+/*! @brief The SSP's APB clock, for working out the pattern at compile time */
+#ifndef WS2812_PCLK
+# ifdef APBCLKDIV_Val
+#  define WS2812_PCLK         (F_CPU / APBCLKDIV_Val)
+# else
+#  define WS2812_PCLK         (F_CPU / 4)
+# endif
+#endif
+
+/*! @brief Latch gap after each refresh (newer WS2812B parts need 280us) */
+#ifndef WS2812_RESET_US
+#define WS2812_RESET_US       (300)
+#endif
+
+/* 3 SSP bits per LED bit (0 = 100, 1 = 110) want SCK of 2.15 - 3.0MHz;
+ *  4 bits (0 = 1000, 1 = 1110) want 3.2 - 3.9MHz.  Use 3 if it fits.
+ */
+#if SSP_CLOCK_ACTUAL(WS2812_PCLK, 3000000) >= 2150000
+# define WS2812_SSP_BITS      (3)                   /*!< SSP bits per LED bit */
+# define WS2812_SCK_HZ        (3000000)             /*!< Upper limit on SCK   */
+# define WS2812_ZERO          (0x4)                 /*!< Pattern for a 0 bit  */
+# define WS2812_ONE           (0x6)                 /*!< Pattern for a 1 bit  */
+#elif SSP_CLOCK_ACTUAL(WS2812_PCLK, 3900000) >= 3200000
+# define WS2812_SSP_BITS      (4)
+# define WS2812_SCK_HZ        (3900000)
+# define WS2812_ZERO          (0x8)
+# define WS2812_ONE           (0xe)
+#endif
+
+/* Otherwise the APB clock is too slow to drive a strip at all */
+#ifdef WS2812_SSP_BITS
+# define WS2812_AVAILABLE                           /*!< Driver is built in   */
+#endif
+
+#ifdef WS2812_AVAILABLE
+
+#define WS2812_PRESCALER      SSP_CLOCK_PRESCALER(WS2812_PCLK, WS2812_SCK_HZ)
+#define WS2812_RATE           SSP_CLOCK_RATE(WS2812_PCLK, WS2812_SCK_HZ)
+#define WS2812_FRAME_BITS     (4 * WS2812_SSP_BITS) /*!< SSP frame: one nibble */
+
+/*! @brief Zero frames making up the latch gap (plus a FIFO's worth, which
+  *  may still be going out when the refresh is reported done)
+  */
+#define WS2812_RESET_FRAMES   ((WS2812_RESET_US * (SSP_CLOCK_ACTUAL(WS2812_PCLK, WS2812_SCK_HZ) \
+                                                   / 1000)                                     \
+                                / (1000 * WS2812_FRAME_BITS)) + 1 + SSP_FifoSize)
+
+/**
+  * @}
+  */
+
+
+/* Types --------------------------------------------------------------------*/
+
+/** @defgroup WS2812_Types
+  * @{
+  */
+
+/*! @brief Refresh-done callback; called from the SSP's ISR */
+typedef void (*WS2812_Callback_Type)(void *Arg);
+
+/*! @brief State for one LED strip */
+typedef struct {
+    SSP_Type                *SSP;       /*!< SSP driving the strip            */
+
+    const uint8_t           *Data;      /*!< Next pixel byte                  */
+    uint32_t                 Left;      /*!< Pixel bytes left                 */
+    uint16_t                 Reset;     /*!< Latch frames left                */
+    uint8_t                  Low;       /*!< Low nibble still to send         */
+    uint8_t                  LowPending;/*!< Low is waiting                   */
+
+    WS2812_Callback_Type     Done;      /*!< Called when finished (or NULL)   */
+    void                    *Arg;       /*!< Passed to Done                   */
+    volatile uint8_t         Busy;      /*!< 1 while a refresh is running     */
+} WS2812_Type;
+
+/**
+  * @}
+  */
+
+
+/* External Functions -------------------------------------------------------*/
+
+/** @defgroup WS2812_Functions WS2812 Exported Functions
+  * @{
+  */
+
+/** @brief  Set up an SSP to drive an LED strip
+  *
+  * @param  [out] W        Strip state to initialize
+  * @param  [in]  SSP      The SSP to use
+  *
+  * @return None.
+  *
+  * Sets the SSP up as master, with the frame size and SCK rate for the
+  *  compiled-in pattern.  The APB clock must match WS2812_PCLK.
+  */
+void WS2812_Init(WS2812_Type *W, SSP_Type *SSP);
+
+/** @brief  Start sending pixel data to the strip
+  *
+  * @param  [in]  W        Strip state
+  * @param  [in]  Pixels   Pixel bytes, in wire order
+  * @param  [in]  Len      Number of bytes (3 or 4 per LED)
+  * @param  [in]  Done     Called (from the ISR) once the latch gap has been
+  *                         queued; may be NULL
+  * @param  [in]  Arg      Passed to Done
+  *
+  * @return 1 if started, 0 if a refresh is already running.
+  *
+  * Doesn't block.  Pixels mustn't change until Done is called.
+  */
+uint8_t WS2812_Show(WS2812_Type *W, const uint8_t *Pixels, uint32_t Len,
+                    WS2812_Callback_Type Done, void *Arg);
+
+/** @brief  Service the SSP's interrupt
+  *
+  * @param  [in]  W        Strip state
+  *
+  * @return None.
+  *
+  * Does NOT acknowledge the VIC.
+  */
+void WS2812_IRQHandler(WS2812_Type *W);
+
+/**
+  * @}
+  */
+
+
+/* Inline Functions ---------------------------------------------------------*/
+
+/** @defgroup WS2812_Inline_Functions
+  * @{
+  */
+
+/** @brief  Determine Whether a Refresh is Running
+  * @param  W       Strip state
+  * @return 1 if busy, 0 otherwise
+  */
+__INLINE static uint8_t WS2812_IsBusy(WS2812_Type *W)
+{
+    return W->Busy;
+}
+
+/**
+  * @}
+  */
+
+#endif /* #ifdef WS2812_AVAILABLE */
+
+/**
+  * @}
+  */
+
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* #ifndef LPC2XXX_WS2812_H_ */
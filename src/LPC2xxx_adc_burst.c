@@ -0,0 +1,234 @@
+/******************************************************************************
+ * @file:    LPC2xxx_adc_burst.c
+ * @purpose: Interrupt-Driven ADC Burst Mode Acquisition
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+#ifdef LPC2XXX_HAS_ADC
+
+#include "LPC2xxx_adc.h"
+#include "LPC2xxx_adc_burst.h"
+#include "LPC2xxx_syscon.h"
+#include "LPC2xxx_lib_assert.h"
+#include "system_LPC2xxx.h"
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Set up burst mode acquisition on an ADC (not started)
+  *
+  * @param  [out] B        Acquisition state to initialize
+  * @param  [in]  ADC      The A to D converter
+  *
+  * @return None.
+  */
+void ADCBurst_Init(ADCBurst_Type *B, ADC_Type *ADC)
+{
+    uint8_t i;
+
+
+    B->ADC = ADC;
+    B->Overruns = 0;
+
+    for (i = 0; i < 8; i++) {
+        B->Ring[i].Buf = 0;
+        B->Ring[i].Mask = 0;
+        B->Ring[i].Head = B->Ring[i].Tail = 0;
+        B->Ring[i].Dropped = 0;
+    }
+}
+
+
+/** @brief  Give a channel a sample ring
+  *
+  * @param  [in]  B        Acquisition state
+  * @param  [in]  Channel  Channel number (0 - 7)
+  * @param  [in]  Buf      Ring storage
+  * @param  [in]  Size     Number of samples in Buf (power of 2)
+  *
+  * @return None.
+  */
+void ADCBurst_SetRing(ADCBurst_Type *B, uint8_t Channel, uint16_t *Buf, uint16_t Size)
+{
+    lpc2xxx_lib_assert(Channel <= 7);
+    lpc2xxx_lib_assert(ADCBURST_IS_RING_SIZE(Size));
+
+    B->Ring[Channel].Buf = Buf;
+    B->Ring[Channel].Mask = Size - 1;
+    B->Ring[Channel].Head = B->Ring[Channel].Tail = 0;
+}
+
+
+/** @brief  Start scanning a set of channels
+  *
+  * @param  [in]  B            Acquisition state
+  * @param  [in]  ChannelMask  Channels to scan (ADC_ChannelMask_*)
+  * @param  [in]  Clock        ADC clock to aim for (Hz, <= ADC_MAX_CLOCK)
+  * @param  [in]  Resolution   Bits per conversion
+  *
+  * @return The ADC clock actually used (Hz); never above Clock.  0 (and
+  *          nothing started) if PCLK / 256 is still above Clock.
+  */
+uint32_t ADCBurst_Start(ADCBurst_Type *B, uint16_t ChannelMask, uint32_t Clock,
+                        ADC_BurstResolution_Type Resolution)
+{
+    uint32_t PClk = SystemCoreClock / SYSCON_GetAPBClockDivider();
+    uint32_t Div;
+    uint8_t  i;
+
+
+    lpc2xxx_lib_assert(ChannelMask != 0);
+    lpc2xxx_lib_assert(ADC_IS_INPUT_MASK(ChannelMask));
+    lpc2xxx_lib_assert(ADC_IS_BURST_RESOLUTION(Resolution));
+    lpc2xxx_lib_assert(Clock != 0);
+
+    /* If CLKDIV can't get down to Clock, don't scan faster than asked */
+    Div = ADC_CalcClockDivider(PClk, Clock);
+    if (Div == 0) {
+        return 0;
+    }
+
+    for (i = 0; i < 8; i++) {
+        B->Ring[i].Tail = B->Ring[i].Head;
+        B->Ring[i].Dropped = 0;
+    }
+    B->Overruns = 0;
+
+    /* Powered up (PDN set), no burst yet and (errata) START left 0 */
+    B->ADC->CR = ADC_PDN;
+    ADC_SetClockDivisor(B->ADC, Div - 1);
+    ADC_EnableChannelMask(B->ADC, ChannelMask);
+    ADC_SetBurstResolution(B->ADC, Resolution);
+
+    /* Clear any stale result so the first interrupt is a fresh one */
+    (void)B->ADC->DR;
+
+    ADC_EnableBurstMode(B->ADC);
+
+    return PClk / Div;
+}
+
+
+/** @brief  Stop scanning
+  *
+  * @param  [in]  B        Acquisition state
+  *
+  * @return None.
+  */
+void ADCBurst_Stop(ADCBurst_Type *B)
+{
+    ADC_DisableBurstMode(B->ADC);
+}
+
+
+/** @brief  Retrieve samples for one channel
+  *
+  * @param  [in]  B        Acquisition state
+  * @param  [in]  Channel  Channel number (0 - 7)
+  * @param  [out] Data     Where to store samples
+  * @param  [in]  Len      Maximum number of samples to retrieve
+  *
+  * @return Number of samples retrieved (0 if none were waiting).
+  */
+uint16_t ADCBurst_Read(ADCBurst_Type *B, uint8_t Channel, uint16_t *Data, uint16_t Len)
+{
+    ADCBurst_Ring_Type *R = &B->Ring[Channel];
+    uint16_t            Tail = R->Tail;
+    uint16_t            Count;
+    uint16_t            i;
+
+
+    lpc2xxx_lib_assert(Channel <= 7);
+
+    Count = (uint16_t)(R->Head - Tail);
+    if (Count > Len) {
+        Count = Len;
+    }
+
+    for (i = 0; i < Count; i++) {
+        Data[i] = R->Buf[Tail & R->Mask];
+        Tail++;
+    }
+
+    R->Tail = Tail;
+
+    return Count;
+}
+
+
+/** @brief  Service an ADC interrupt
+  *
+  * @param  [in]  B        Acquisition state for the interrupting ADC
+  *
+  * @return None.
+  */
+void ADCBurst_IRQHandler(ADCBurst_Type *B)
+{
+    ADCBurst_Ring_Type *R;
+    uint32_t            DR;
+    uint16_t            Head;
+
+
+    /* Reading DR clears DONE and the interrupt */
+    DR = B->ADC->DR;
+    if (!(DR & ADC_DONE)) {
+        return;
+    }
+
+    if (DR & ADC_OVERRUN) {
+        B->Overruns++;
+    }
+
+    R = &B->Ring[ADC_CHANNEL(DR)];
+    if (R->Buf == 0) {
+        return;
+    }
+
+    Head = R->Head;
+    if ((uint16_t)(Head - R->Tail) > R->Mask) {
+        R->Dropped++;
+    } else {
+        R->Buf[Head & R->Mask] = ADC_RESULT(DR);
+        R->Head = Head + 1;
+    }
+}
+
+#endif /* #ifdef LPC2XXX_HAS_ADC */
+
@@ -0,0 +1,345 @@
+/******************************************************************************
+ * @file:    LPC2xxx_adc_dual.c
+ * @purpose: Simultaneous Sampling on ADC0 and ADC1
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+#ifdef LPC2XXX_HAS_ADC1
+
+#include "LPC2xxx_adc.h"
+#include "LPC2xxx_adc_timed.h"
+#include "LPC2xxx_adc_dual.h"
+#include "LPC2xxx_syscon.h"
+#include "LPC2xxx_lib_assert.h"
+#include "system_LPC2xxx.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/* Polls of ADC0 to allow for its result trailing ADC1's; an ADC clock is
+ *  at most 256 PCLKs, and each poll is several
+ */
+#define ADCDUAL_PAIR_POLLS              (64)
+
+/** @brief  Select a channel on each ADC, at the same (fastest) ADC clock
+  * @param  Channel0 Channel on ADC0
+  * @param  Channel1 Channel on ADC1
+  * @return The ADC clock (Hz), or 0 (nothing set up) if PCLK is too fast
+  */
+static uint32_t ADCDual_Configure(uint8_t Channel0, uint8_t Channel1)
+{
+    uint32_t PClk = SystemCoreClock / SYSCON_GetAPBClockDivider();
+    uint32_t Div;
+
+
+    Div = ADC_CalcClockDivider(PClk, ADC_MAX_CLOCK);
+    if (Div == 0) {
+        return 0;
+    }
+
+    /* One channel each, no burst, START left 0; PDN set = powered up */
+    ADC0->CR = ADC_PDN;
+    ADC1->CR = ADC_PDN;
+    ADC_SetClockDivisor(ADC0, Div - 1);
+    ADC_SetClockDivisor(ADC1, Div - 1);
+    ADC_EnableChannel(ADC0, Channel0);
+    ADC_EnableChannel(ADC1, Channel1);
+    (void)ADC0->DR;
+    (void)ADC1->DR;
+
+    return PClk / Div;
+}
+
+/** @brief  Set what starts both ADCs
+  * @param  Start   Start condition (as for ADC_SetStartMode())
+  * @return None.
+  */
+static void ADCDual_SetStart(ADC_Start_Type Start)
+{
+#ifdef LPC2XXX_HAS_ADC_GLOBAL_START
+    /* Note: GEDGE is the bit above the GSTART bits, like EDGE in CR */
+    ADC0->GSR = Start << ADC_GSTART_Shift;
+#else
+    ADC_SetStartMode(ADC0, Start);
+    ADC_SetStartMode(ADC1, Start);
+#endif
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Start sampling a channel on each ADC together at a fixed rate
+  *
+  * @param  [out] D         Dual sampling state to initialize
+  * @param  [in]  Channel0  Channel to sample on ADC0 (0 - 7)
+  * @param  [in]  Channel1  Channel to sample on ADC1 (0 - 7)
+  * @param  [in]  Trigger   Timer match to start conversions from
+  * @param  [in]  Rate      Pairs per second
+  * @param  [in]  Ring      Ring storage, 2 * Pairs results
+  * @param  [in]  Pairs     Ring size in pairs (power of 2)
+  *
+  * @return The sample rate set up, in mHz, or 0 if Rate is out of reach.
+  */
+uint32_t ADCDual_Start(ADCDual_Type *D, uint8_t Channel0, uint8_t Channel1,
+                       ADC_Start_Type Trigger, uint32_t Rate,
+                       uint16_t *Ring, uint16_t Pairs)
+{
+    uint32_t AdcClock;
+    uint32_t Actual;
+
+
+    lpc2xxx_lib_assert(Channel0 <= 7);
+    lpc2xxx_lib_assert(Channel1 <= 7);
+    lpc2xxx_lib_assert(ADCDUAL_IS_RING_SIZE(Pairs));
+
+    ADCDual_SetStart(ADC_Start_None);
+    AdcClock = ADCDual_Configure(Channel0, Channel1);
+
+    /* Each conversion has to finish before the next edge */
+    if ((Rate == 0) || (Rate > AdcClock / ADC_CONVERSION_CLOCKS)) {
+        return 0;
+    }
+
+    Actual = ADCTimed_SetupPacer(Trigger, Rate, &D->Timer);
+    if (Actual == 0) {
+        return 0;
+    }
+
+    D->Ring     = Ring;
+    D->Mask     = Pairs - 1;
+    D->Head     = D->Tail = 0;
+    D->Dropped  = 0;
+    D->Overruns = 0;
+    D->Unpaired = 0;
+
+    /* ADC1 finishes each pair off; ADC0 is picked up along with it.
+     *  Without INTEN, ADC0's VIC line being off keeps it quiet.
+     */
+#ifdef LPC2XXX_HAS_ADC_CHANNEL_REGS
+    ADC_SetInterruptMask(ADC0, 0);
+    ADC_SetInterruptMask(ADC1, ADC_ADGINTEN);
+#endif
+
+    ADCDual_SetStart(Trigger);
+    ADCTimed_StartPacer(D->Timer);
+
+    return Actual;
+}
+
+
+/** @brief  Stop sampling
+  *
+  * @param  [in]  D         Dual sampling state
+  *
+  * @return None.
+  */
+void ADCDual_Stop(ADCDual_Type *D)
+{
+    ADCTimed_StopPacer(D->Timer);
+    ADCDual_SetStart(ADC_Start_None);
+}
+
+
+/** @brief  Retrieve sample pairs
+  *
+  * @param  [in]  D         Dual sampling state
+  * @param  [out] Data      Where to store the pairs (ADC0, ADC1, ADC0, ...)
+  * @param  [in]  Pairs     Maximum number of pairs to retrieve
+  *
+  * @return Number of pairs retrieved (0 if none were waiting).
+  */
+uint16_t ADCDual_Read(ADCDual_Type *D, uint16_t *Data, uint16_t Pairs)
+{
+    uint16_t *Pair;
+    uint16_t  Tail = D->Tail;
+    uint16_t  Count;
+    uint16_t  i;
+
+
+    Count = (uint16_t)(D->Head - Tail);
+    if (Count > Pairs) {
+        Count = Pairs;
+    }
+
+    for (i = 0; i < Count; i++) {
+        Pair = &D->Ring[(Tail & D->Mask) * 2];
+        *Data++ = Pair[0];
+        *Data++ = Pair[1];
+        Tail++;
+    }
+
+    D->Tail = Tail;
+
+    return Count;
+}
+
+
+/** @brief  Service ADC1's interrupt
+  *
+  * @param  [in]  D         Dual sampling state
+  *
+  * @return None.
+  */
+void ADCDual_IRQHandler(ADCDual_Type *D)
+{
+    uint16_t *Pair;
+    uint32_t  DR0;
+    uint32_t  DR1;
+    uint16_t  Head;
+    uint8_t   Polls = ADCDUAL_PAIR_POLLS;
+
+
+    /* Reading DR clears DONE and the interrupt */
+    DR1 = ADC1->DR;
+    if (!(DR1 & ADC_DONE)) {
+        return;
+    }
+
+    /* ADC0 may be up to an ADC clock behind */
+    do {
+        DR0 = ADC0->DR;
+    } while (!(DR0 & ADC_DONE) && --Polls);
+
+    if (!(DR0 & ADC_DONE)) {
+        D->Unpaired++;
+        return;
+    }
+
+    if ((DR0 | DR1) & ADC_OVERRUN) {
+        D->Overruns++;
+    }
+
+    Head = D->Head;
+    if ((uint16_t)(Head - D->Tail) > D->Mask) {
+        D->Dropped++;
+        return;
+    }
+
+    Pair = &D->Ring[(Head & D->Mask) * 2];
+    Pair[0] = ADC_RESULT(DR0);
+    Pair[1] = ADC_RESULT(DR1);
+    D->Head = Head + 1;
+}
+
+
+/** @brief  Measure how far apart the two ADCs convert
+  *
+  * @param  [in]  Channel0  Channel to convert on ADC0 (0 - 7)
+  * @param  [in]  Channel1  Channel to convert on ADC1 (0 - 7)
+  * @param  [in]  Clock     A free-running timer counting PCLKs
+  * @param  [in]  Trials    Number of pairs to time (at least 1)
+  *
+  * @return The average time from ADC0's result to ADC1's, in PCLKs (0 if
+  *          PCLK can't be divided down to ADC_MAX_CLOCK).
+  */
+int32_t ADCDual_MeasureSkew(uint8_t Channel0, uint8_t Channel1,
+                            ADCTimed_Timer_Type *Clock, uint8_t Trials)
+{
+#ifdef LPC2XXX_HAS_ADC_CHANNEL_REGS
+    uint32_t IntEn0 = ADC0->INTEN;
+    uint32_t IntEn1 = ADC1->INTEN;
+#endif
+    uint32_t Now;
+    uint32_t Done0 = 0;
+    uint32_t Done1 = 0;
+    int32_t  Sum = 0;
+    uint8_t  Pending;
+    uint8_t  i;
+
+
+    lpc2xxx_lib_assert(Channel0 <= 7);
+    lpc2xxx_lib_assert(Channel1 <= 7);
+    lpc2xxx_lib_assert(Trials != 0);
+
+#ifdef LPC2XXX_HAS_ADC_CHANNEL_REGS
+    ADC_SetInterruptMask(ADC0, 0);
+    ADC_SetInterruptMask(ADC1, 0);
+#endif
+
+    ADCDual_SetStart(ADC_Start_None);
+    if (ADCDual_Configure(Channel0, Channel1) == 0) {
+#ifdef LPC2XXX_HAS_ADC_CHANNEL_REGS
+        ADC_SetInterruptMask(ADC0, IntEn0);
+        ADC_SetInterruptMask(ADC1, IntEn1);
+#endif
+        return 0;
+    }
+
+    for (i = 0; i < Trials; i++) {
+        ADCDual_SetStart(ADC_Start_Now);
+
+        /* Both results are checked against the same timestamp each time
+         *  round, so finishing together reads as 0
+         */
+        Pending = 3;
+        while (Pending) {
+            Now = Clock->TC;
+            if ((Pending & 1) && (ADC0->DR & ADC_DONE)) {
+                Done0 = Now;
+                Pending &= ~1;
+            }
+            if ((Pending & 2) && (ADC1->DR & ADC_DONE)) {
+                Done1 = Now;
+                Pending &= ~2;
+            }
+        }
+
+        Sum += (int32_t)(Done1 - Done0);
+    }
+
+    ADCDual_SetStart(ADC_Start_None);
+
+#ifdef LPC2XXX_HAS_ADC_CHANNEL_REGS
+    ADC_SetInterruptMask(ADC0, IntEn0);
+    ADC_SetInterruptMask(ADC1, IntEn1);
+#endif
+
+    return Sum / Trials;
+}
+
+#endif /* #ifdef LPC2XXX_HAS_ADC1 */
+
@@ -0,0 +1,281 @@
+/******************************************************************************
+ * @file:    LPC2xxx_adc_timed.c
+ * @purpose: Timer-Paced ADC Sampling
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+#if defined(LPC2XXX_HAS_ADC) && (defined(LPC2XXX_HAS_TIMER) || defined(LPC2XXX_HAS_CT32B))
+
+#include "LPC2xxx_adc.h"
+#include "LPC2xxx_adc_timed.h"
+#include "LPC2xxx_syscon.h"
+#include "LPC2xxx_lib_assert.h"
+#include "system_LPC2xxx.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/* The same timer API under either name */
+#if defined(LPC2XXX_HAS_TIMER)
+# define ADCTIMED_TIMER0                TIMER0
+# define ADCTIMED_TIMER1                TIMER1
+# define ADCTimed_TimerDisable          TIMER_Disable
+# define ADCTimed_TimerEnable           TIMER_Enable
+# define ADCTimed_TimerAssertReset      TIMER_AssertReset
+# define ADCTimed_TimerDeassertReset    TIMER_DeassertReset
+# define ADCTimed_TimerSetMode          TIMER_SetMode
+# define ADCTimed_TimerSetPrescaler     TIMER_SetPrescaler
+# define ADCTimed_TimerSetMatchValue    TIMER_SetChannelMatchValue
+# define ADCTimed_TimerSetMatchControl  TIMER_SetChannelMatchControl
+# define ADCTimed_TimerSetExtMatch      TIMER_SetChannelExtMatchControl
+# define ADCTIMED_MODE_TIMER            TIMER_Mode_Timer
+# define ADCTIMED_MATCH_RESET           TIMER_MatchControl_Reset
+# define ADCTIMED_EXTMATCH_TOGGLE       TIMER_ExtMatchControl_Toggle
+#else
+# define ADCTIMED_TIMER0                CT32B0
+# define ADCTIMED_TIMER1                CT32B1
+# define ADCTimed_TimerDisable          CT32B_Disable
+# define ADCTimed_TimerEnable           CT32B_Enable
+# define ADCTimed_TimerAssertReset      CT32B_AssertReset
+# define ADCTimed_TimerDeassertReset    CT32B_DeassertReset
+# define ADCTimed_TimerSetMode          CT32B_SetMode
+# define ADCTimed_TimerSetPrescaler     CT32B_SetPrescaler
+# define ADCTimed_TimerSetMatchValue    CT32B_SetChannelMatchValue
+# define ADCTimed_TimerSetMatchControl  CT32B_SetChannelMatchControl
+# define ADCTimed_TimerSetExtMatch      CT32B_SetChannelExtMatchControl
+# define ADCTIMED_MODE_TIMER            CT32B_Mode_Timer
+# define ADCTIMED_MATCH_RESET           CT32B_MatchControl_Reset
+# define ADCTIMED_EXTMATCH_TOGGLE       CT32B_ExtMatchControl_Toggle
+#endif
+
+/* Match channel behind each START setting (2 - 5: timer 0, 6 - 7: timer 1) */
+static const uint8_t ADCTimed_MatchChannel[8] = { 0, 0, 2, 0, 1, 3, 0, 1 };
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Set up the timer behind an ADC start source to pace conversions
+  *
+  * @param  [in]  Trigger  Timer match start source
+  * @param  [in]  Rate     Conversions per second
+  * @param  [out] Timer    Where to put the timer that was set up
+  *
+  * @return The rate set up, in mHz, or 0 if Rate is too fast for the timer.
+  */
+uint32_t ADCTimed_SetupPacer(ADC_Start_Type Trigger, uint32_t Rate, ADCTimed_Timer_Type **Timer)
+{
+    uint32_t PClk = SystemCoreClock / SYSCON_GetAPBClockDivider();
+    uint32_t Half;
+    uint8_t  Match;
+
+
+    lpc2xxx_lib_assert(ADCTIMED_IS_TRIGGER(Trigger));
+
+    /* The match bit toggles, so it takes two matches per rising edge */
+    Half = (Rate == 0) ? 0 : (PClk + Rate) / (2 * Rate);
+    if (Half == 0) {
+        return 0;
+    }
+
+    *Timer = ((Trigger & 0x07) >= (ADC_Start_TIMER1_MAT0_Rising & 0x07))
+             ? ADCTIMED_TIMER1 : ADCTIMED_TIMER0;
+    Match = ADCTimed_MatchChannel[Trigger & 0x07];
+
+    ADCTimed_TimerDisable(*Timer);
+    ADCTimed_TimerAssertReset(*Timer);
+    ADCTimed_TimerSetMode(*Timer, ADCTIMED_MODE_TIMER);
+    ADCTimed_TimerSetPrescaler(*Timer, 0);
+    ADCTimed_TimerSetMatchValue(*Timer, Match, Half - 1);
+    ADCTimed_TimerSetMatchControl(*Timer, Match, ADCTIMED_MATCH_RESET);
+    ADCTimed_TimerSetExtMatch(*Timer, Match, ADCTIMED_EXTMATCH_TOGGLE);
+
+    return (uint32_t)(((uint64_t)PClk * 500 + Half / 2) / Half);
+}
+
+
+/** @brief  Let a pacing timer run
+  *
+  * @param  [in]  Timer    Timer from ADCTimed_SetupPacer()
+  *
+  * @return None.
+  */
+void ADCTimed_StartPacer(ADCTimed_Timer_Type *Timer)
+{
+    ADCTimed_TimerDeassertReset(Timer);
+    ADCTimed_TimerEnable(Timer);
+}
+
+
+/** @brief  Stop a pacing timer
+  *
+  * @param  [in]  Timer    Timer from ADCTimed_SetupPacer()
+  *
+  * @return None.
+  */
+void ADCTimed_StopPacer(ADCTimed_Timer_Type *Timer)
+{
+    ADCTimed_TimerDisable(Timer);
+}
+
+
+/** @brief  Start sampling one channel at a fixed rate
+  *
+  * @param  [out] T        Sampling state to initialize
+  * @param  [in]  ADC      The A to D converter
+  * @param  [in]  Channel  Channel to sample (0 - 7)
+  * @param  [in]  Trigger  Timer match to start conversions from
+  * @param  [in]  Rate     Samples per second
+  * @param  [in]  BufA     First sample buffer
+  * @param  [in]  BufB     Second sample buffer (NULL = reuse BufA)
+  * @param  [in]  Len      Samples per buffer
+  * @param  [in]  Done     Called (from the ISR) with each full buffer
+  * @param  [in]  Arg      Passed to Done
+  *
+  * @return The sample rate set up, in mHz, or 0 if Rate is out of reach.
+  */
+uint32_t ADCTimed_Start(ADCTimed_Type *T, ADC_Type *ADC, uint8_t Channel,
+                        ADC_Start_Type Trigger, uint32_t Rate,
+                        uint16_t *BufA, uint16_t *BufB, uint16_t Len,
+                        ADCTimed_Callback_Type Done, void *Arg)
+{
+    uint32_t PClk = SystemCoreClock / SYSCON_GetAPBClockDivider();
+    uint32_t Div;
+    uint32_t Actual;
+
+
+    lpc2xxx_lib_assert(Channel <= 7);
+    lpc2xxx_lib_assert(Rate != 0);
+    lpc2xxx_lib_assert(BufA != 0);
+    lpc2xxx_lib_assert(Len != 0);
+
+    Div = ADC_CalcClockDivider(PClk, ADC_MAX_CLOCK);
+
+    /* Each conversion has to finish before the next edge */
+    if ((Div == 0) || (Rate == 0) || (Rate > PClk / Div / ADC_CONVERSION_CLOCKS)) {
+        return 0;
+    }
+
+    Actual = ADCTimed_SetupPacer(Trigger, Rate, &T->Timer);
+    if (Actual == 0) {
+        return 0;
+    }
+
+    T->ADC      = ADC;
+    T->Buf[0]   = BufA;
+    T->Buf[1]   = BufB ? BufB : BufA;
+    T->Len      = Len;
+    T->Pos      = 0;
+    T->Fill     = 0;
+    T->Done     = Done;
+    T->Arg      = Arg;
+    T->Blocks   = 0;
+    T->Overruns = 0;
+
+    /* One channel, no burst; PDN set = powered up */
+    ADC->CR = ADC_PDN;
+    ADC_SetClockDivisor(ADC, Div - 1);
+    ADC_EnableChannel(ADC, Channel);
+    (void)ADC->DR;
+    ADC_SetStartMode(ADC, Trigger);
+
+    ADCTimed_StartPacer(T->Timer);
+
+    return Actual;
+}
+
+
+/** @brief  Stop sampling
+  *
+  * @param  [in]  T        Sampling state
+  *
+  * @return None.
+  */
+void ADCTimed_Stop(ADCTimed_Type *T)
+{
+    ADCTimed_StopPacer(T->Timer);
+    ADC_SetStartMode(T->ADC, ADC_Start_None);
+}
+
+
+/** @brief  Service an ADC interrupt
+  *
+  * @param  [in]  T        Sampling state for the interrupting ADC
+  *
+  * @return None.
+  */
+void ADCTimed_IRQHandler(ADCTimed_Type *T)
+{
+    uint16_t *Buf;
+    uint32_t  DR;
+
+
+    /* Reading DR clears DONE and the interrupt */
+    DR = T->ADC->DR;
+    if (!(DR & ADC_DONE)) {
+        return;
+    }
+
+    if (DR & ADC_OVERRUN) {
+        T->Overruns++;
+    }
+
+    Buf = T->Buf[T->Fill];
+    Buf[T->Pos++] = ADC_RESULT(DR);
+
+    if (T->Pos == T->Len) {
+        T->Pos = 0;
+        T->Fill ^= 1;
+        T->Blocks++;
+
+        if (T->Done) {
+            T->Done(T->Arg, Buf, T->Len);
+        }
+    }
+}
+
+#endif /* #if defined(LPC2XXX_HAS_ADC) && (defined(LPC2XXX_HAS_TIMER) || defined(LPC2XXX_HAS_CT32B)) */
+
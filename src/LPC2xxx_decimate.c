@@ -0,0 +1,372 @@
+/******************************************************************************
+ * @file:    LPC2xxx_decimate.c
+ * @purpose: Fixed-Point CIC / FIR Decimation Filters
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+#include "LPC2xxx_decimate.h"
+#include "LPC2xxx_lib_assert.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief  Multiply-accumulate Q15 taps against Q15 samples
+  * @param  C       Taps
+  * @param  X       Samples, newest first
+  * @param  N       Number of taps
+  * @return The sum, Q30, with rounding for a shift down to Q15 added in
+  */
+DECIMATE_ARM_CODE
+static inline int64_t Decimate_MACQ15(const int16_t *C, const int16_t *X, uint16_t N)
+{
+    int64_t Acc = 1 << 14;
+
+
+    /* 64 bit sums of 32 bit products: SMLAL */
+    for (; N >= 4; N -= 4) {
+        Acc += (int64_t)C[0] * X[0];
+        Acc += (int64_t)C[1] * X[1];
+        Acc += (int64_t)C[2] * X[2];
+        Acc += (int64_t)C[3] * X[3];
+        C += 4;
+        X += 4;
+    }
+
+    while (N--) {
+        Acc += (int64_t)*C++ * *X++;
+    }
+
+    return Acc;
+}
+
+/** @brief  Multiply-accumulate Q31 taps against Q31 samples
+  * @param  C       Taps
+  * @param  X       Samples, newest first
+  * @param  N       Number of taps
+  * @return The sum, Q62, with rounding for a shift down to Q31 added in
+  */
+DECIMATE_ARM_CODE
+static inline int64_t Decimate_MACQ31(const int32_t *C, const int32_t *X, uint16_t N)
+{
+    int64_t Acc = 1 << 30;
+
+
+    for (; N >= 4; N -= 4) {
+        Acc += (int64_t)C[0] * X[0];
+        Acc += (int64_t)C[1] * X[1];
+        Acc += (int64_t)C[2] * X[2];
+        Acc += (int64_t)C[3] * X[3];
+        C += 4;
+        X += 4;
+    }
+
+    while (N--) {
+        Acc += (int64_t)*C++ * *X++;
+    }
+
+    return Acc;
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Set up a CIC decimator
+  *
+  * @param  [out] C        CIC state to initialize
+  * @param  [in]  Order    Number of integrator / comb stages (1 - 4)
+  * @param  [in]  Ratio    Decimation ratio
+  *
+  * @return None.
+  */
+void Decimate_CICInit(Decimate_CIC_Type *C, uint8_t Order, uint16_t Ratio)
+{
+    uint32_t Gain = 1;
+    uint8_t  Bits = 0;
+    uint8_t  i;
+
+
+    lpc2xxx_lib_assert(DECIMATE_IS_CIC(Order, Ratio));
+
+    for (i = 0; (i < Order) && (Gain <= 65536); i++) {
+        Gain *= Ratio;
+    }
+    lpc2xxx_lib_assert(Gain <= 65536);
+
+    while ((1UL << Bits) < Gain) {
+        Bits++;
+    }
+
+    C->Order = Order;
+    C->Shift = 16 - Bits;
+    C->Ratio = Ratio;
+    C->Phase = 0;
+
+    for (i = 0; i < DECIMATE_CIC_MAX_ORDER; i++) {
+        C->Integ[i] = 0;
+        C->Comb[i] = 0;
+    }
+}
+
+
+/** @brief  Run raw ADC results through a CIC decimator
+  *
+  * @param  [in]  C        CIC state
+  * @param  [in]  In       ADC results (as ADC_RESULT())
+  * @param  [in]  Len      Number of results
+  * @param  [out] Out      Where to put the output, Q31
+  *
+  * @return Number of output samples.
+  */
+DECIMATE_FASTCODE
+uint16_t Decimate_CIC(Decimate_CIC_Type *C, const uint16_t *In, uint16_t Len, int32_t *Out)
+{
+    uint32_t I1 = C->Integ[0];
+    uint32_t I2 = C->Integ[1];
+    uint32_t I3 = C->Integ[2];
+    uint32_t I4 = C->Integ[3];
+    uint32_t Y;
+    uint32_t T;
+    uint16_t Phase = C->Phase;
+    uint16_t Count = 0;
+    uint8_t  k;
+
+
+    while (Len--) {
+        /* All four integrators always run (it's cheaper than choosing);
+         *  the ones past Order just aren't looked at
+         */
+        I1 += (uint32_t)(int32_t)DECIMATE_ADC_TO_Q15(*In++);
+        I2 += I1;
+        I3 += I2;
+        I4 += I3;
+
+        if (++Phase < C->Ratio) {
+            continue;
+        }
+        Phase = 0;
+
+        switch (C->Order) {
+        case 1:  Y = I1; break;
+        case 2:  Y = I2; break;
+        case 3:  Y = I3; break;
+        default: Y = I4; break;
+        }
+
+        for (k = 0; k < C->Order; k++) {
+            T = Y;
+            Y -= C->Comb[k];
+            C->Comb[k] = T;
+        }
+
+        Out[Count++] = (int32_t)(Y << C->Shift);
+    }
+
+    C->Integ[0] = I1;
+    C->Integ[1] = I2;
+    C->Integ[2] = I3;
+    C->Integ[3] = I4;
+    C->Phase = Phase;
+
+    return Count;
+}
+
+
+/** @brief  Set up a Q15 FIR filter
+  *
+  * @param  [out] F        FIR state to initialize
+  * @param  [in]  Coeffs   Taps, Q15 (kept, not copied)
+  * @param  [in]  NumTaps  Number of taps
+  * @param  [in]  Ratio    Decimation ratio (1 for plain filtering)
+  * @param  [in]  State    Delay line storage, 2 * NumTaps samples
+  *
+  * @return None.
+  */
+void Decimate_FIRQ15Init(Decimate_FIRQ15_Type *F, const int16_t *Coeffs, uint16_t NumTaps,
+                         uint16_t Ratio, int16_t *State)
+{
+    uint32_t i;
+
+
+    lpc2xxx_lib_assert(NumTaps != 0);
+    lpc2xxx_lib_assert(Ratio != 0);
+
+    F->Coeffs  = Coeffs;
+    F->State   = State;
+    F->NumTaps = NumTaps;
+    F->Pos     = 0;
+    F->Ratio   = Ratio;
+    F->Phase   = 0;
+
+    for (i = 0; i < 2 * (uint32_t)NumTaps; i++) {
+        State[i] = 0;
+    }
+}
+
+
+/** @brief  Run a block of samples through a Q15 FIR filter
+  *
+  * @param  [in]  F        FIR state
+  * @param  [in]  In       Input samples, Q15
+  * @param  [in]  Len      Number of input samples
+  * @param  [out] Out      Where to put the output, Q15; may be In
+  *
+  * @return Number of output samples.
+  */
+DECIMATE_FASTCODE
+uint16_t Decimate_FIRQ15(Decimate_FIRQ15_Type *F, const int16_t *In, uint16_t Len, int16_t *Out)
+{
+    int16_t  *State = F->State;
+    uint16_t  Taps  = F->NumTaps;
+    uint16_t  Pos   = F->Pos;
+    uint16_t  Phase = F->Phase;
+    uint16_t  Count = 0;
+    int64_t   Acc;
+
+
+    while (Len--) {
+        /* Newest sample goes in front of the last, in both copies */
+        Pos = (Pos ? Pos : Taps) - 1;
+        State[Pos] = State[Pos + Taps] = *In++;
+
+        if (++Phase < F->Ratio) {
+            continue;
+        }
+        Phase = 0;
+
+        Acc = Decimate_MACQ15(F->Coeffs, &State[Pos], Taps) >> 15;
+        if (Acc > 32767) {
+            Acc = 32767;
+        } else if (Acc < -32768) {
+            Acc = -32768;
+        }
+
+        Out[Count++] = (int16_t)Acc;
+    }
+
+    F->Pos = Pos;
+    F->Phase = Phase;
+
+    return Count;
+}
+
+
+/** @brief  Set up a Q31 FIR filter
+  *
+  * @param  [out] F        FIR state to initialize
+  * @param  [in]  Coeffs   Taps, Q31 (kept, not copied)
+  * @param  [in]  NumTaps  Number of taps
+  * @param  [in]  Ratio    Decimation ratio (1 for plain filtering)
+  * @param  [in]  State    Delay line storage, 2 * NumTaps samples
+  *
+  * @return None.
+  */
+void Decimate_FIRQ31Init(Decimate_FIRQ31_Type *F, const int32_t *Coeffs, uint16_t NumTaps,
+                         uint16_t Ratio, int32_t *State)
+{
+    uint32_t i;
+
+
+    lpc2xxx_lib_assert(NumTaps != 0);
+    lpc2xxx_lib_assert(Ratio != 0);
+
+    F->Coeffs  = Coeffs;
+    F->State   = State;
+    F->NumTaps = NumTaps;
+    F->Pos     = 0;
+    F->Ratio   = Ratio;
+    F->Phase   = 0;
+
+    for (i = 0; i < 2 * (uint32_t)NumTaps; i++) {
+        State[i] = 0;
+    }
+}
+
+
+/** @brief  Run a block of samples through a Q31 FIR filter
+  *
+  * @param  [in]  F        FIR state
+  * @param  [in]  In       Input samples, Q31
+  * @param  [in]  Len      Number of input samples
+  * @param  [out] Out      Where to put the output, Q31; may be In
+  *
+  * @return Number of output samples.
+  */
+DECIMATE_FASTCODE
+uint16_t Decimate_FIRQ31(Decimate_FIRQ31_Type *F, const int32_t *In, uint16_t Len, int32_t *Out)
+{
+    int32_t  *State = F->State;
+    uint16_t  Taps  = F->NumTaps;
+    uint16_t  Pos   = F->Pos;
+    uint16_t  Phase = F->Phase;
+    uint16_t  Count = 0;
+    int64_t   Acc;
+
+
+    while (Len--) {
+        Pos = (Pos ? Pos : Taps) - 1;
+        State[Pos] = State[Pos + Taps] = *In++;
+
+        if (++Phase < F->Ratio) {
+            continue;
+        }
+        Phase = 0;
+
+        Acc = Decimate_MACQ31(F->Coeffs, &State[Pos], Taps) >> 31;
+        if (Acc > INT32_MAX) {
+            Acc = INT32_MAX;
+        } else if (Acc < INT32_MIN) {
+            Acc = INT32_MIN;
+        }
+
+        Out[Count++] = (int32_t)Acc;
+    }
+
+    F->Pos = Pos;
+    F->Phase = Phase;
+
+    return Count;
+}
+
@@ -0,0 +1,593 @@
+/******************************************************************************
+ * @file:    LPC2xxx_enc28j60.c
+ * @purpose: ENC28J60 SPI Ethernet Controller Driver Over SSP
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+#if defined(LPC2XXX_HAS_SSP) && defined(LPC2XXX_HAS_GPIO)
+
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_gpio.h"
+#include "LPC2xxx_enc28j60.h"
+#include "LPC2xxx_lib_assert.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/* SPI opcodes */
+#define ENC_OP_RCR          (0x00)      /* Read control register             */
+#define ENC_OP_RBM          (0x3a)      /* Read buffer memory                */
+#define ENC_OP_WCR          (0x40)      /* Write control register            */
+#define ENC_OP_WBM          (0x7a)      /* Write buffer memory               */
+#define ENC_OP_BFS          (0x80)      /* Bit field set                     */
+#define ENC_OP_BFC          (0xa0)      /* Bit field clear                   */
+#define ENC_OP_SRC          (0xff)      /* System reset                      */
+
+/* Registers: bits 0-4 address, 5-6 bank, 7 set for MAC / MII registers
+ *  (which clock out a dummy byte before their data)
+ */
+#define ENC_BANK(Reg)       (((Reg) >> 5) & 0x03)
+#define ENC_ADDR(Reg)       ((Reg) & 0x1f)
+#define ENC_IS_MAC(Reg)     ((Reg) & 0x80)
+
+#define ENC_ERDPTL          (0x00)
+#define ENC_ERDPTH          (0x01)
+#define ENC_EWRPTL          (0x02)
+#define ENC_EWRPTH          (0x03)
+#define ENC_ETXSTL          (0x04)
+#define ENC_ETXSTH          (0x05)
+#define ENC_ETXNDL          (0x06)
+#define ENC_ETXNDH          (0x07)
+#define ENC_ERXSTL          (0x08)
+#define ENC_ERXSTH          (0x09)
+#define ENC_ERXNDL          (0x0a)
+#define ENC_ERXNDH          (0x0b)
+#define ENC_ERXRDPTL        (0x0c)
+#define ENC_ERXRDPTH        (0x0d)
+#define ENC_ERXFCON         (0x38)
+#define ENC_EPKTCNT         (0x39)
+#define ENC_MACON1          (0xc0)
+#define ENC_MACON3          (0xc2)
+#define ENC_MACON4          (0xc3)
+#define ENC_MABBIPG         (0xc4)
+#define ENC_MAIPGL          (0xc6)
+#define ENC_MAIPGH          (0xc7)
+#define ENC_MAMXFLL         (0xca)
+#define ENC_MAMXFLH         (0xcb)
+#define ENC_MICMD           (0xd2)
+#define ENC_MIREGADR        (0xd4)
+#define ENC_MIWRL           (0xd6)
+#define ENC_MIWRH           (0xd7)
+#define ENC_MIRDL           (0xd8)
+#define ENC_MIRDH           (0xd9)
+#define ENC_MAADR5          (0xe0)
+#define ENC_MAADR6          (0xe1)
+#define ENC_MAADR3          (0xe2)
+#define ENC_MAADR4          (0xe3)
+#define ENC_MAADR1          (0xe4)
+#define ENC_MAADR2          (0xe5)
+#define ENC_MISTAT          (0xea)
+#define ENC_EREVID          (0x72)
+
+/* Common to all banks */
+#define ENC_EIR             (0x1c)
+#define ENC_ESTAT           (0x1d)
+#define ENC_ECON2           (0x1e)
+#define ENC_ECON1           (0x1f)
+
+#define ENC_EIR_TXERIF      (0x02)
+#define ENC_ESTAT_CLKRDY    (0x01)
+#define ENC_ECON2_AUTOINC   (0x80)
+#define ENC_ECON2_PKTDEC    (0x40)
+#define ENC_ECON1_TXRST     (0x80)
+#define ENC_ECON1_TXRTS     (0x08)
+#define ENC_ECON1_RXEN      (0x04)
+#define ENC_ECON1_BSEL      (0x03)
+#define ENC_ERXFCON_UCEN    (0x80)
+#define ENC_ERXFCON_CRCEN   (0x20)
+#define ENC_ERXFCON_BCEN    (0x01)
+#define ENC_MACON1_TXPAUS   (0x08)
+#define ENC_MACON1_RXPAUS   (0x04)
+#define ENC_MACON1_MARXEN   (0x01)
+#define ENC_MACON3_PADCFG0  (0x20)
+#define ENC_MACON3_TXCRCEN  (0x10)
+#define ENC_MACON3_FRMLNEN  (0x02)
+#define ENC_MACON4_DEFER    (0x40)
+#define ENC_MICMD_MIIRD     (0x01)
+#define ENC_MISTAT_BUSY     (0x01)
+
+/* PHY registers */
+#define ENC_PHCON1          (0x00)
+#define ENC_PHCON2          (0x10)
+#define ENC_PHSTAT2         (0x11)
+#define ENC_PHCON2_HDLDIS   (0x0100)
+#define ENC_PHSTAT2_LSTAT   (0x0400)
+
+/* Buffer memory: Rx ring first (errata: must start at 0), then room for
+ *  one Tx frame with its control byte and 7 byte status vector
+ */
+#define ENC_RX_START        (0x0000)
+#define ENC_RX_END          (0x19ff)
+#define ENC_TX_START        (0x1a00)
+
+/* Bytes of the Rx ring header: next pointer + receive status vector */
+#define ENC_RX_HDR_LEN      (6)
+#define ENC_RSV_RXOK        (0x80)      /* In the third status byte          */
+
+/* ESTAT polls to wait after reset (errata: CLKRDY isn't to be trusted;
+ *  wait 1ms).  Each poll is 16 SPI clocks, so >= 0.8us at 20MHz.
+ */
+#define ENC_RESET_POLLS     (1250)
+
+/** @brief  Run one SPI operation
+  * @param  E       Controller state
+  * @param  Op      Opcode ORed with any register address
+  * @param  TxData  Data to send after the opcode (NULL = ones)
+  * @param  RxData  Where to put data received after the opcode (or NULL)
+  * @param  Len     Bytes of data after the opcode
+  * @return None.
+  */
+static void ENC28J60_Op(ENC28J60_Type *E, uint8_t Op, const void *TxData, void *RxData,
+                        uint32_t Len)
+{
+    GPIO_ClearPins(E->CSPort, E->CSPin);
+
+    SSP_WriteBlock(E->SSP, &Op, 1);
+    if (Len) {
+        SSP_XferBlock(E->SSP, TxData, RxData, Len);
+    }
+
+    GPIO_SetPins(E->CSPort, E->CSPin);
+}
+
+/** @brief  Set or clear bits in a common (all-bank) ETH register
+  * @param  E       Controller state
+  * @param  Op      ENC_OP_BFS or ENC_OP_BFC
+  * @param  Reg     Register
+  * @param  Bits    Bits to set / clear
+  * @return None.
+  */
+static void ENC28J60_BitOp(ENC28J60_Type *E, uint8_t Op, uint8_t Reg, uint8_t Bits)
+{
+    ENC28J60_Op(E, Op | ENC_ADDR(Reg), &Bits, 0, 1);
+}
+
+/** @brief  Switch to a register's bank, if it isn't common to all banks
+  * @param  E       Controller state
+  * @param  Reg     Register about to be accessed
+  * @return None.
+  */
+static void ENC28J60_SelectBank(ENC28J60_Type *E, uint8_t Reg)
+{
+    uint8_t Bank = ENC_BANK(Reg);
+
+
+    if ((ENC_ADDR(Reg) < 0x1b) && (Bank != E->Bank)) {
+        ENC28J60_BitOp(E, ENC_OP_BFC, ENC_ECON1, ENC_ECON1_BSEL);
+        if (Bank) {
+            ENC28J60_BitOp(E, ENC_OP_BFS, ENC_ECON1, Bank);
+        }
+        E->Bank = Bank;
+    }
+}
+
+/** @brief  Read a control register
+  * @param  E       Controller state
+  * @param  Reg     Register
+  * @return The register's value
+  */
+static uint8_t ENC28J60_Read(ENC28J60_Type *E, uint8_t Reg)
+{
+    uint8_t Data[2];
+
+
+    ENC28J60_SelectBank(E, Reg);
+    ENC28J60_Op(E, ENC_OP_RCR | ENC_ADDR(Reg), 0, Data, ENC_IS_MAC(Reg) ? 2:1);
+
+    return ENC_IS_MAC(Reg) ? Data[1]:Data[0];
+}
+
+/** @brief  Write a control register
+  * @param  E       Controller state
+  * @param  Reg     Register
+  * @param  Value   Value to write
+  * @return None.
+  */
+static void ENC28J60_Write(ENC28J60_Type *E, uint8_t Reg, uint8_t Value)
+{
+    ENC28J60_SelectBank(E, Reg);
+    ENC28J60_Op(E, ENC_OP_WCR | ENC_ADDR(Reg), &Value, 0, 1);
+}
+
+/** @brief  Write a 16 bit register pair (low byte register first)
+  * @param  E       Controller state
+  * @param  RegL    Low byte register
+  * @param  Value   Value to write
+  * @return None.
+  */
+static void ENC28J60_Write16(ENC28J60_Type *E, uint8_t RegL, uint16_t Value)
+{
+    ENC28J60_Write(E, RegL, Value);
+    ENC28J60_Write(E, RegL + 1, Value >> 8);
+}
+
+/** @brief  Read a PHY register
+  * @param  E       Controller state
+  * @param  Reg     PHY register
+  * @return The register's value
+  */
+static uint16_t ENC28J60_ReadPhy(ENC28J60_Type *E, uint8_t Reg)
+{
+    ENC28J60_Write(E, ENC_MIREGADR, Reg);
+    ENC28J60_Write(E, ENC_MICMD, ENC_MICMD_MIIRD);
+    while (ENC28J60_Read(E, ENC_MISTAT) & ENC_MISTAT_BUSY);
+    ENC28J60_Write(E, ENC_MICMD, 0);
+
+    return ENC28J60_Read(E, ENC_MIRDL) | (ENC28J60_Read(E, ENC_MIRDH) << 8);
+}
+
+/** @brief  Write a PHY register
+  * @param  E       Controller state
+  * @param  Reg     PHY register
+  * @param  Value   Value to write
+  * @return None.
+  */
+static void ENC28J60_WritePhy(ENC28J60_Type *E, uint8_t Reg, uint16_t Value)
+{
+    ENC28J60_Write(E, ENC_MIREGADR, Reg);
+    ENC28J60_Write16(E, ENC_MIWRL, Value);
+    while (ENC28J60_Read(E, ENC_MISTAT) & ENC_MISTAT_BUSY);
+}
+
+/** @brief  Read the next frame out of the chip's Rx ring, if there's room
+  * @param  E       Controller state
+  * @return 1 if a frame was taken off the chip (kept or dropped), 0 if
+  *          there was none or nowhere to put it
+  */
+static uint8_t ENC28J60_Receive(ENC28J60_Type *E)
+{
+    ENC28J60_Packet_Type *P;
+    uint8_t               Hdr[ENC_RX_HDR_LEN];
+    uint16_t              Len;
+    uint16_t              Free;
+
+
+    if (ENC28J60_Read(E, ENC_EPKTCNT) == 0) {
+        return 0;
+    }
+
+    /* Leave frames in the chip's buffer until there's somewhere to put them */
+    if ((E->Free == 0)
+     || ((uint8_t)(E->RxHead - E->RxTail) >= ENC28J60_QUEUE_SIZE))
+    {
+        return 0;
+    }
+
+    ENC28J60_Write16(E, ENC_ERDPTL, E->RxNext);
+    ENC28J60_Op(E, ENC_OP_RBM, 0, Hdr, ENC_RX_HDR_LEN);
+
+    E->RxNext = Hdr[0] | (Hdr[1] << 8);
+    Len = (Hdr[2] | (Hdr[3] << 8)) - 4;
+
+    if ((Hdr[4] & ENC_RSV_RXOK) && (Len <= ENC28J60_MAX_FRAME)) {
+        P = E->Free;
+        E->Free = P->Next;
+
+        /* ERDPT wraps at the end of the Rx ring on its own */
+        ENC28J60_Op(E, ENC_OP_RBM, 0, P->Data, Len);
+        P->Len = Len;
+
+        E->RxQ[E->RxHead & (ENC28J60_QUEUE_SIZE - 1)] = P;
+        E->RxHead++;
+        E->RxFrames++;
+    } else {
+        E->RxErrors++;
+    }
+
+    /* Hand the space back (errata: ERXRDPT must be odd) */
+    Free = (E->RxNext == ENC_RX_START) ? ENC_RX_END : E->RxNext - 1;
+    ENC28J60_Write16(E, ENC_ERXRDPTL, Free);
+    ENC28J60_BitOp(E, ENC_OP_BFS, ENC_ECON2, ENC_ECON2_PKTDEC);
+
+    return 1;
+}
+
+/** @brief  Start sending a frame
+  * @param  E       Controller state
+  * @param  P       The frame
+  * @return None.
+  */
+static void ENC28J60_Transmit(ENC28J60_Type *E, ENC28J60_Packet_Type *P)
+{
+    uint8_t Hdr[2];
+
+
+    /* Errata: the transmit logic can hang after an error; reset it */
+    if (ENC28J60_Read(E, ENC_EIR) & ENC_EIR_TXERIF) {
+        ENC28J60_BitOp(E, ENC_OP_BFS, ENC_ECON1, ENC_ECON1_TXRST);
+        ENC28J60_BitOp(E, ENC_OP_BFC, ENC_ECON1, ENC_ECON1_TXRST);
+        ENC28J60_BitOp(E, ENC_OP_BFC, ENC_EIR, ENC_EIR_TXERIF);
+    }
+
+    Hdr[0] = ENC_OP_WBM;
+    Hdr[1] = 0;             /* Per-packet control byte: use MACON3 settings */
+
+    ENC28J60_Write16(E, ENC_EWRPTL, ENC_TX_START);
+
+    GPIO_ClearPins(E->CSPort, E->CSPin);
+    SSP_WriteBlock(E->SSP, Hdr, 2);
+    SSP_WriteBlock(E->SSP, P->Data, P->Len);
+    GPIO_SetPins(E->CSPort, E->CSPin);
+
+    ENC28J60_Write16(E, ENC_ETXNDL, ENC_TX_START + P->Len);
+    ENC28J60_BitOp(E, ENC_OP_BFS, ENC_ECON1, ENC_ECON1_TXRTS);
+
+    E->TxBusy = P;
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Reset and set up an ENC28J60, and start receiving
+  *
+  * @param  [out] E        Controller state to initialize
+  * @param  [in]  SSP      The SSP the chip is on (set up already)
+  * @param  [in]  CSPort   Chip select GPIO port
+  * @param  [in]  CSPin    Chip select pin (as a mask)
+  * @param  [in]  Mac      The station's MAC address
+  * @param  [in]  Pool     Packet buffers
+  * @param  [in]  Count    Number of packets in Pool
+  *
+  * @return The chip's revision ID, or 0 if nothing answered.
+  */
+uint8_t ENC28J60_Init(ENC28J60_Type *E, SSP_Type *SSP, GPIO_Type *CSPort, uint32_t CSPin,
+                      const uint8_t Mac[6], ENC28J60_Packet_Type *Pool, uint16_t Count)
+{
+    uint32_t i;
+    uint8_t  Rev;
+
+
+    lpc2xxx_lib_assert(Pool != 0);
+    lpc2xxx_lib_assert(Count != 0);
+    lpc2xxx_lib_assert((ENC28J60_QUEUE_SIZE & (ENC28J60_QUEUE_SIZE - 1)) == 0);
+
+    E->SSP    = SSP;
+    E->CSPort = CSPort;
+    E->CSPin  = CSPin;
+    E->Bank   = 0;
+    E->RxNext = ENC_RX_START;
+    E->RxHead = E->RxTail = 0;
+    E->TxHead = E->TxTail = 0;
+    E->TxBusy = 0;
+    E->RxFrames = E->RxErrors = 0;
+    E->TxFrames = E->TxErrors = 0;
+
+    E->Free = 0;
+    for (i = 0; i < Count; i++) {
+        Pool[i].Next = E->Free;
+        E->Free = &Pool[i];
+    }
+
+    GPIO_SetPins(CSPort, CSPin);
+
+    ENC28J60_Op(E, ENC_OP_SRC, 0, 0, 0);
+    for (i = 0; i < ENC_RESET_POLLS; i++) {
+        ENC28J60_Read(E, ENC_ESTAT);
+    }
+    if (!(ENC28J60_Read(E, ENC_ESTAT) & ENC_ESTAT_CLKRDY)) {
+        return 0;
+    }
+
+    Rev = ENC28J60_Read(E, ENC_EREVID);
+    if ((Rev == 0x00) || (Rev == 0xff)) {
+        return 0;
+    }
+
+    /* Buffer memory layout */
+    ENC28J60_Write16(E, ENC_ERXSTL, ENC_RX_START);
+    ENC28J60_Write16(E, ENC_ERXNDL, ENC_RX_END);
+    ENC28J60_Write16(E, ENC_ERXRDPTL, ENC_RX_END);
+    ENC28J60_Write16(E, ENC_ETXSTL, ENC_TX_START);
+    ENC28J60_BitOp(E, ENC_OP_BFS, ENC_ECON2, ENC_ECON2_AUTOINC);
+
+    ENC28J60_Write(E, ENC_ERXFCON, ENC_ERXFCON_UCEN | ENC_ERXFCON_CRCEN | ENC_ERXFCON_BCEN);
+
+    /* MAC: half duplex, pad and CRC outgoing frames, check lengths */
+    ENC28J60_Write(E, ENC_MACON1, ENC_MACON1_MARXEN);
+    ENC28J60_Write(E, ENC_MACON3, ENC_MACON3_PADCFG0 | ENC_MACON3_TXCRCEN
+                                | ENC_MACON3_FRMLNEN);
+    ENC28J60_Write(E, ENC_MACON4, ENC_MACON4_DEFER);
+    ENC28J60_Write16(E, ENC_MAMXFLL, ENC28J60_MAX_FRAME + 4);
+    ENC28J60_Write(E, ENC_MABBIPG, 0x12);
+    ENC28J60_Write(E, ENC_MAIPGL, 0x12);
+    ENC28J60_Write(E, ENC_MAIPGH, 0x0c);
+
+    ENC28J60_Write(E, ENC_MAADR1, Mac[0]);
+    ENC28J60_Write(E, ENC_MAADR2, Mac[1]);
+    ENC28J60_Write(E, ENC_MAADR3, Mac[2]);
+    ENC28J60_Write(E, ENC_MAADR4, Mac[3]);
+    ENC28J60_Write(E, ENC_MAADR5, Mac[4]);
+    ENC28J60_Write(E, ENC_MAADR6, Mac[5]);
+
+    /* PHY: half duplex whatever the LED straps say, and don't loop our own
+     *  transmissions back
+     */
+    ENC28J60_WritePhy(E, ENC_PHCON1, 0);
+    ENC28J60_WritePhy(E, ENC_PHCON2, ENC_PHCON2_HDLDIS);
+
+    ENC28J60_BitOp(E, ENC_OP_BFS, ENC_ECON1, ENC_ECON1_RXEN);
+
+    return Rev;
+}
+
+
+/** @brief  Move frames between the chip and the queues
+  *
+  * @param  [in]  E        Controller state
+  *
+  * @return None.
+  */
+void ENC28J60_Poll(ENC28J60_Type *E)
+{
+    ENC28J60_Packet_Type *P;
+
+
+    while (ENC28J60_Receive(E));
+
+    if (E->TxBusy) {
+        if (ENC28J60_Read(E, ENC_ECON1) & ENC_ECON1_TXRTS) {
+            return;
+        }
+
+        if (ENC28J60_Read(E, ENC_EIR) & ENC_EIR_TXERIF) {
+            E->TxErrors++;
+        } else {
+            E->TxFrames++;
+        }
+
+        ENC28J60_Free(E, E->TxBusy);
+        E->TxBusy = 0;
+    }
+
+    if (E->TxHead != E->TxTail) {
+        P = E->TxQ[E->TxTail & (ENC28J60_QUEUE_SIZE - 1)];
+        E->TxTail++;
+        ENC28J60_Transmit(E, P);
+    }
+}
+
+
+/** @brief  Take a packet from the pool
+  *
+  * @param  [in]  E        Controller state
+  *
+  * @return A packet to fill in and ENC28J60_Send(), or 0 if none are free.
+  */
+ENC28J60_Packet_Type *ENC28J60_Alloc(ENC28J60_Type *E)
+{
+    ENC28J60_Packet_Type *P = E->Free;
+
+
+    if (P) {
+        E->Free = P->Next;
+    }
+
+    return P;
+}
+
+
+/** @brief  Give a packet back to the pool
+  *
+  * @param  [in]  E        Controller state
+  * @param  [in]  P        The packet
+  *
+  * @return None.
+  */
+void ENC28J60_Free(ENC28J60_Type *E, ENC28J60_Packet_Type *P)
+{
+    P->Next = E->Free;
+    E->Free = P;
+}
+
+
+/** @brief  Take the oldest received frame off the receive queue
+  *
+  * @param  [in]  E        Controller state
+  *
+  * @return The packet (to be freed or re-sent when done), or 0 if none.
+  */
+ENC28J60_Packet_Type *ENC28J60_Recv(ENC28J60_Type *E)
+{
+    ENC28J60_Packet_Type *P;
+
+
+    if (E->RxHead == E->RxTail) {
+        return 0;
+    }
+
+    P = E->RxQ[E->RxTail & (ENC28J60_QUEUE_SIZE - 1)];
+    E->RxTail++;
+
+    return P;
+}
+
+
+/** @brief  Queue a frame to send
+  *
+  * @param  [in]  E        Controller state
+  * @param  [in]  P        The packet, Data and Len filled in
+  *
+  * @return 1 if queued, 0 if the transmit queue is full.
+  */
+uint8_t ENC28J60_Send(ENC28J60_Type *E, ENC28J60_Packet_Type *P)
+{
+    lpc2xxx_lib_assert(P->Len <= ENC28J60_MAX_FRAME);
+
+    if ((uint8_t)(E->TxHead - E->TxTail) >= ENC28J60_QUEUE_SIZE) {
+        return 0;
+    }
+
+    E->TxQ[E->TxHead & (ENC28J60_QUEUE_SIZE - 1)] = P;
+    E->TxHead++;
+
+    return 1;
+}
+
+
+/** @brief  Determine Whether the Link is Up
+  *
+  * @param  [in]  E        Controller state
+  *
+  * @return 1 if the PHY has a link, 0 otherwise.
+  */
+uint8_t ENC28J60_LinkIsUp(ENC28J60_Type *E)
+{
+    return (ENC28J60_ReadPhy(E, ENC_PHSTAT2) & ENC_PHSTAT2_LSTAT) ? 1:0;
+}
+
+#endif /* #if defined(LPC2XXX_HAS_SSP) && defined(LPC2XXX_HAS_GPIO) */
+
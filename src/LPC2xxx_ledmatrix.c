@@ -0,0 +1,295 @@
+/******************************************************************************
+ * @file:    LPC2xxx_ledmatrix.c
+ * @purpose: Multiplexed LED Matrix Scan Engine
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+#if defined(LPC2XXX_HAS_CT16B) && defined(LPC2XXX_HAS_SSP)
+
+#include "LPC2xxx_ct16b.h"
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_ledmatrix.h"
+#include "LPC2xxx_lib_assert.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief  Start shifting a slice's column data out to the shift registers
+  * @param  M       Matrix state
+  * @param  Word    Column bits
+  * @return None.
+  *
+  * At most 4 bytes, so they always fit in the Tx FIFO.
+  */
+static inline void LEDMatrix_Shift(LEDMatrix_Type *M, uint32_t Word)
+{
+    SSP_Type *SSP = M->Config->SSP;
+    int8_t Shift;
+
+
+    /* Nothing useful comes back; keep the Rx FIFO from overrunning */
+    while (SSP_RxIsAvailable(SSP)) {
+        SSP_Recv(SSP);
+    }
+
+    for (Shift = (M->Config->Columns - 1) & ~7; Shift >= 0; Shift -= 8) {
+        SSP_Send(SSP, (Word >> Shift) & 0xff);
+    }
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Set up and start scanning an LED matrix
+  *
+  * @param  [out] M        Matrix state to initialize
+  * @param  [in]  Config   Wiring and timing
+  * @param  [in]  BufA     First frame buffer, LEDMATRIX_BUFFER_WORDS() words
+  * @param  [in]  BufB     Second frame buffer, the same size
+  *
+  * @return None.
+  */
+void LEDMatrix_Init(LEDMatrix_Type *M, const LEDMatrix_Config_Type *Config,
+                    uint32_t *BufA, uint32_t *BufB)
+{
+    CT16B_Type *Timer = Config->Timer;
+    uint16_t i;
+
+
+    lpc2xxx_lib_assert((Config->Rows != 0) && (Config->Columns != 0));
+    lpc2xxx_lib_assert(Config->Columns <= LEDMATRIX_MAX_COLUMNS);
+    lpc2xxx_lib_assert((Config->BaseTicks != 0)
+                    && (Config->BaseTicks <= (0xffff >> (LEDMATRIX_PLANES - 1))));
+
+    M->Config      = Config;
+    M->Front       = BufA;
+    M->Back        = BufB;
+    M->SwapPending = 0;
+    M->Row         = 0;
+    M->Plane       = 0;
+    M->Lit         = 0;
+    M->Frames      = 0;
+
+    if (Config->Columns == 32) {
+        M->ColMask = 0xffffffff;
+    } else {
+        M->ColMask = ((1UL << Config->Columns) - 1) << Config->ColShift;
+    }
+
+    for (i = 0; i < LEDMATRIX_BUFFER_WORDS(Config->Rows); i++) {
+        BufA[i] = 0;
+        BufB[i] = 0;
+    }
+
+    for (i = 0; i < LEDMATRIX_PLANES; i++) {
+        M->Period[i] = Config->BaseTicks << i;
+    }
+    LEDMatrix_SetBrightness(M, 256);
+
+    for (i = 0; i < Config->Rows; i++) {
+        Config->RowPort->CLR = Config->RowPins[i];
+    }
+
+    if (Config->SSP) {
+        LEDMatrix_Shift(M, 0);
+    }
+
+    /* The first MR1 match starts the first slice */
+    CT16B_Disable(Timer);
+    CT16B_AssertReset(Timer);
+    CT16B_SetMode(Timer, CT16B_Mode_Timer);
+    CT16B_SetPrescaler(Timer, Config->Prescaler);
+    CT16B_SetChannelMatchValue(Timer, 0, 0xffff);
+    CT16B_SetChannelMatchValue(Timer, 1, M->Period[0] - 1);
+    CT16B_SetChannelMatchControl(Timer, 0, CT16B_MatchControl_Interrupt);
+    CT16B_SetChannelMatchControl(Timer, 1, CT16B_MatchControl_Interrupt
+                                           | CT16B_MatchControl_Reset);
+    CT16B_ClearPendingIT(Timer, CT16B_IT_MR0 | CT16B_IT_MR1);
+    CT16B_DeassertReset(Timer);
+    CT16B_Enable(Timer);
+}
+
+
+/** @brief  Convert a greyscale image into the back buffer
+  *
+  * @param  [in]  M        Matrix state
+  * @param  [in]  Grey     Rows * Columns levels (0 - 255), row by row
+  *
+  * @return None.
+  */
+void LEDMatrix_LoadFrame(LEDMatrix_Type *M, const uint8_t *Grey)
+{
+    const LEDMatrix_Config_Type *Config = M->Config;
+    uint32_t *Planes = M->Back;
+    uint32_t Bit;
+    uint8_t Level;
+    uint8_t Row;
+    uint8_t Col;
+    uint8_t b;
+
+
+    lpc2xxx_lib_assert(!M->SwapPending);
+
+    for (Row = 0; Row < Config->Rows; Row++) {
+        for (b = 0; b < LEDMATRIX_PLANES; b++) {
+            Planes[b] = 0;
+        }
+
+        for (Col = 0, Bit = 1; Col < Config->Columns; Col++, Bit <<= 1) {
+            Level = *Grey++;
+
+            for (b = 0; Level; b++, Level >>= 1) {
+                if (Level & 1) {
+                    Planes[b] |= Bit;
+                }
+            }
+        }
+
+        Planes += LEDMATRIX_PLANES;
+    }
+}
+
+
+/** @brief  Set the overall brightness
+  *
+  * @param  [in]  M        Matrix state
+  * @param  [in]  Level    0 (off) - 256 (full)
+  *
+  * @return None.
+  */
+void LEDMatrix_SetBrightness(LEDMatrix_Type *M, uint16_t Level)
+{
+    uint8_t b;
+
+
+    lpc2xxx_lib_assert(Level <= 256);
+
+    for (b = 0; b < LEDMATRIX_PLANES; b++) {
+        M->On[b] = ((uint32_t)M->Period[b] * Level) >> 8;
+    }
+}
+
+
+/** @brief  Service the timer's interrupt
+  *
+  * @param  [in]  M        Matrix state
+  *
+  * @return None.
+  */
+void LEDMatrix_IRQHandler(LEDMatrix_Type *M)
+{
+    const LEDMatrix_Config_Type *Config = M->Config;
+    CT16B_Type *Timer = Config->Timer;
+    uint8_t Pending;
+    uint8_t Row;
+    uint8_t Plane;
+    uint32_t Word;
+    uint32_t *Buf;
+
+
+    Pending = CT16B_GetPendingIT(Timer) & (CT16B_IT_MR0 | CT16B_IT_MR1);
+    CT16B_ClearPendingIT(Timer, Pending);
+
+    /* End of the on time, or of the whole slice: the row goes dark */
+    if (M->Lit) {
+        Config->RowPort->CLR = M->Lit;
+        M->Lit = 0;
+    }
+
+    if (!(Pending & CT16B_IT_MR1)) {
+        return;
+    }
+
+    /* Start of a new slice; the counter's already running for it */
+    Row = M->Row;
+    Plane = M->Plane;
+
+    CT16B_SetChannelMatchValue(Timer, 1, M->Period[Plane] - 1);
+    CT16B_SetChannelMatchValue(Timer, 0, M->On[Plane]);
+
+    if (Config->SSP) {
+        Config->ColPort->SET = Config->LatchPin;
+        Config->ColPort->CLR = Config->LatchPin;
+    } else {
+        Word = M->Front[Row * LEDMATRIX_PLANES + Plane] << Config->ColShift;
+        Config->ColPort->SET = Word & M->ColMask;
+        Config->ColPort->CLR = ~Word & M->ColMask;
+    }
+
+    if (M->On[Plane]) {
+        M->Lit = Config->RowPins[Row];
+        Config->RowPort->SET = M->Lit;
+    }
+
+    /* Line up the next slice */
+    if (++Plane == LEDMATRIX_PLANES) {
+        Plane = 0;
+
+        if (++Row == Config->Rows) {
+            Row = 0;
+            M->Frames++;
+
+            if (M->SwapPending) {
+                Buf = M->Front;
+                M->Front = M->Back;
+                M->Back = Buf;
+                M->SwapPending = 0;
+            }
+        }
+    }
+
+    M->Row = Row;
+    M->Plane = Plane;
+
+    if (Config->SSP) {
+        LEDMatrix_Shift(M, M->Front[Row * LEDMATRIX_PLANES + Plane]);
+    }
+}
+
+#endif /* #if defined(LPC2XXX_HAS_CT16B) && defined(LPC2XXX_HAS_SSP) */
+
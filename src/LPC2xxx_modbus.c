@@ -0,0 +1,513 @@
+/******************************************************************************
+ * @file:    LPC2xxx_modbus.c
+ * @purpose: Interrupt-Driven Modbus RTU Slave for LPC2xxx CPUs
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+/* Needs an old-style 32-bit TIMER for frame timing */
+#ifdef LPC2XXX_HAS_TIMER
+
+#include "LPC2xxx_uart.h"
+#include "LPC2xxx_timer.h"
+#include "LPC2xxx_modbus.h"
+#include "LPC2xxx_syscon.h"
+#include "LPC2xxx_lib_assert.h"
+#include "system_LPC2xxx.h"
+
+
+/* Variables ----------------------------------------------------------------*/
+
+/* CRC-16 (poly 0xa001, reflected), a nibble at a time */
+static const uint16_t Modbus_CRCTable[16] = {
+    0x0000, 0xcc01, 0xd801, 0x1400, 0xf001, 0x3c00, 0x2800, 0xe401,
+    0xa001, 0x6c00, 0x7800, 0xb401, 0x5000, 0x9c01, 0x8801, 0x4400
+};
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief  Add one byte to a running CRC
+  * @param  Crc     CRC so far
+  * @param  b       Byte to add
+  * @return Updated CRC
+  */
+static inline uint16_t Modbus_CRCByte(uint16_t Crc, uint8_t b)
+{
+    Crc ^= b;
+    Crc = (Crc >> 4) ^ Modbus_CRCTable[Crc & 0x0f];
+    Crc = (Crc >> 4) ^ Modbus_CRCTable[Crc & 0x0f];
+
+    return Crc;
+}
+
+/** @brief  Get a big-endian 16 bit value from a frame
+  * @param  p       Where the value is
+  * @return The value
+  */
+static inline uint16_t Modbus_Get16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+/** @brief  Put a big-endian 16 bit value into a frame
+  * @param  p       Where the value goes
+  * @param  v       The value
+  * @return None.
+  */
+static inline void Modbus_Put16(uint8_t *p, uint16_t v)
+{
+    p[0] = v >> 8;
+    p[1] = v & 0xff;
+}
+
+/** @brief  Carry out a request, building the response over it
+  * @param  MB      Slave state
+  * @param  Len     Length of the request (address + PDU, no CRC)
+  * @return Length of the response (address + PDU, no CRC)
+  */
+static uint16_t Modbus_Process(Modbus_Type *MB, uint16_t Len)
+{
+    uint8_t *Buf = MB->Buf;
+    uint8_t Function = Buf[1];
+    uint8_t Exception = MODBUS_EX_NONE;
+    uint16_t Start;
+    uint16_t Count;
+    uint16_t Value;
+    uint16_t i;
+
+
+    /* The function code is checked first, as Modbus requires */
+    if ((Function != MODBUS_FC_READ_HOLDING) && (Function != MODBUS_FC_READ_INPUT)
+     && (Function != MODBUS_FC_WRITE_SINGLE) && (Function != MODBUS_FC_WRITE_MULTIPLE))
+    {
+        Exception = MODBUS_EX_ILLEGAL_FUNCTION;
+        goto exception;
+    }
+
+    /* All supported requests carry at least a start address and a count
+     *  or value after the function code.
+     */
+    if (Len < 6) {
+        Exception = MODBUS_EX_ILLEGAL_DATA_VALUE;
+        goto exception;
+    }
+
+    Start = Modbus_Get16(&Buf[2]);
+    Count = Modbus_Get16(&Buf[4]);
+
+    switch (Function) {
+        case MODBUS_FC_READ_HOLDING:
+        case MODBUS_FC_READ_INPUT:
+            if ((Len != 6) || (Count < 1) || (Count > 125)) {
+                Exception = MODBUS_EX_ILLEGAL_DATA_VALUE;
+                break;
+            }
+
+            /* Response: addr, fc, byte count, registers... */
+            for (i = 0; i < Count; i++) {
+                Exception = MB->Read(MB->Arg,
+                                     (Function == MODBUS_FC_READ_HOLDING)
+                                         ? Modbus_Table_Holding : Modbus_Table_Input,
+                                     Start + i, &Value);
+                if (Exception != MODBUS_EX_NONE) {
+                    break;
+                }
+                Modbus_Put16(&Buf[3 + 2 * i], Value);
+            }
+
+            if (Exception == MODBUS_EX_NONE) {
+                Buf[2] = Count * 2;
+                return 3 + Count * 2;
+            }
+            break;
+
+        case MODBUS_FC_WRITE_SINGLE:
+            if (Len != 6) {
+                Exception = MODBUS_EX_ILLEGAL_DATA_VALUE;
+                break;
+            }
+            if (MB->Write == 0) {
+                Exception = MODBUS_EX_ILLEGAL_FUNCTION;
+                break;
+            }
+
+            /* Response echoes the request */
+            Exception = MB->Write(MB->Arg, Start, Count);
+            if (Exception == MODBUS_EX_NONE) {
+                return 6;
+            }
+            break;
+
+        case MODBUS_FC_WRITE_MULTIPLE:
+            if ((Len < 7) || (Count < 1) || (Count > 123)
+             || (Buf[6] != Count * 2) || (Len != 7 + Count * 2))
+            {
+                Exception = MODBUS_EX_ILLEGAL_DATA_VALUE;
+                break;
+            }
+            if (MB->Write == 0) {
+                Exception = MODBUS_EX_ILLEGAL_FUNCTION;
+                break;
+            }
+
+            /* Registers are written in order; a failure part way through
+             *  leaves the earlier ones written.
+             */
+            for (i = 0; i < Count; i++) {
+                Exception = MB->Write(MB->Arg, Start + i, Modbus_Get16(&Buf[7 + 2 * i]));
+                if (Exception != MODBUS_EX_NONE) {
+                    break;
+                }
+            }
+
+            /* Response: addr, fc, start, count */
+            if (Exception == MODBUS_EX_NONE) {
+                return 6;
+            }
+            break;
+
+        default:
+            Exception = MODBUS_EX_ILLEGAL_FUNCTION;
+            break;
+    }
+
+exception:
+    Buf[1] = Function | 0x80;
+    Buf[2] = Exception;
+
+    return 3;
+}
+
+/** @brief  (Re)start the one-shot t3.5 count from now
+  * @param  MB      Slave state
+  * @return None.
+  */
+static inline void Modbus_StartT35(Modbus_Type *MB)
+{
+    TIMER_SetCount(MB->Timer, 0);
+    TIMER_SetPrescalerCount(MB->Timer, 0);
+    TIMER_Enable(MB->Timer);
+}
+
+/** @brief  Load the Tx FIFO with as much of the response as will fit
+  * @param  MB      Slave state
+  * @return None.
+  *
+  * Must only be called when the Tx FIFO is empty (THRE).
+  */
+static inline void Modbus_FillTxFifo(Modbus_Type *MB)
+{
+    uint8_t Room = UART_TxFifoSize;
+
+
+    if (MB->TxLeft == 0) {
+        /* The last byte is still in the shift register and its echo is
+         *  yet to come; stay Transmitting until t3.5 from now, when the
+         *  timer ISR checks TEMT and goes back to Idle.
+         */
+        UART_DisableIT(MB->Uart, UART_IT_TxData);
+        Modbus_StartT35(MB);
+        return;
+    }
+
+    while (Room-- && MB->TxLeft) {
+        UART_Send(MB->Uart, *MB->TxData++);
+        MB->TxLeft--;
+    }
+}
+
+/** @brief  Take in everything waiting in the Rx FIFO
+  * @param  MB      Slave state
+  * @return None.
+  */
+static inline void Modbus_DrainRxFifo(Modbus_Type *MB)
+{
+    UART_Type *Uart = MB->Uart;
+    uint8_t c;
+
+
+    while (UART_GetLineStatus(Uart) & UART_LineStatus_RxData) {
+        c = UART_Recv(Uart);
+
+        /* Half duplex: anything heard while answering is our own echo
+         *  or a bus fault; either way it isn't a request.
+         */
+        if (MB->State == Modbus_State_Transmitting) {
+            continue;
+        }
+
+        if (MB->State == Modbus_State_Idle) {
+            MB->State = Modbus_State_Receiving;
+            MB->Len   = 0;
+            MB->Crc   = 0xffff;
+            MB->Bad   = 0;
+        }
+
+        if (MB->Len < MODBUS_ADU_MAX) {
+            MB->Buf[MB->Len++] = c;
+            MB->Crc = Modbus_CRCByte(MB->Crc, c);
+        } else {
+            MB->Bad = 1;
+        }
+    }
+
+    if (MB->State == Modbus_State_Receiving) {
+        /* (Re)start the t3.5 count from this byte */
+        Modbus_StartT35(MB);
+    }
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Calculate the Modbus CRC of a block of data
+  *
+  * @param  [in]  Crc      Starting value (0xffff for a new frame)
+  * @param  [in]  Data     Bytes to add to the CRC
+  * @param  [in]  Len      Number of bytes
+  *
+  * @return The updated CRC.
+  */
+uint16_t Modbus_CRC(uint16_t Crc, const uint8_t *Data, uint16_t Len)
+{
+    while (Len--) {
+        Crc = Modbus_CRCByte(Crc, *Data++);
+    }
+
+    return Crc;
+}
+
+
+/** @brief  Set up a Modbus RTU slave and start listening
+  *
+  * @param  [out] MB       Slave state to initialize
+  * @param  [in]  Uart     UART on the bus (line settings already done)
+  * @param  [in]  Timer    Timer to use for frame timing (MR0)
+  * @param  [in]  Address  Slave address (1 - 247)
+  * @param  [in]  Baud     The UART's baud rate (for t3.5)
+  * @param  [in]  Read     Register read callback
+  * @param  [in]  Write    Holding register write callback (0 = read only)
+  * @param  [in]  Arg      Passed to the callbacks
+  *
+  * @return None.
+  */
+void Modbus_Init(Modbus_Type *MB, UART_Type *Uart, TIMER_Type *Timer,
+                 uint8_t Address, uint32_t Baud,
+                 Modbus_ReadCallback_Type Read, Modbus_WriteCallback_Type Write,
+                 void *Arg)
+{
+    uint32_t PClk = SystemCoreClock / SYSCON_GetAPBClockDivider();
+    uint32_t T35;
+
+
+    lpc2xxx_lib_assert((Address >= 1) && (Address <= 247));
+    lpc2xxx_lib_assert(Read != 0);
+    lpc2xxx_lib_assert(Baud != 0);
+
+    MB->Uart      = Uart;
+    MB->Timer     = Timer;
+    MB->Address   = Address;
+    MB->Read      = Read;
+    MB->Write     = Write;
+    MB->Arg       = Arg;
+    MB->State     = Modbus_State_Idle;
+    MB->Len       = 0;
+    MB->TxLeft    = 0;
+    MB->Frames    = 0;
+    MB->CrcErrors = 0;
+    MB->Errors    = 0;
+
+    /* 3.5 characters of 11 bits, or 1750us above 19200 baud */
+    if (Baud <= 19200) {
+        T35 = (PClk / Baud) * 77 / 2;
+    } else {
+        T35 = (PClk / 4000) * 7;
+    }
+
+    /* One-shot: count PCLKs up to t3.5, then interrupt, reset and stop */
+    TIMER_Disable(Timer);
+    TIMER_SetMode(Timer, TIMER_Mode_Timer);
+    TIMER_SetPrescaler(Timer, 0);
+    TIMER_SetChannelMatchValue(Timer, 0, T35);
+    TIMER_SetChannelMatchControl(Timer, 0, TIMER_MatchControl_Interrupt
+                                           | TIMER_MatchControl_Reset
+                                           | TIMER_MatchControl_Stop);
+    TIMER_SetCount(Timer, 0);
+    TIMER_ClearPendingIT(Timer, TIMER_IT_MR0);
+
+    UART_DisableIT(Uart, UART_IT_Mask);
+    UART_SetRxFifoTrigger(Uart, UART_RxFifoTrigger_1);
+    UART_FlushRxFifo(Uart);
+    UART_FlushTxFifo(Uart);
+    UART_GetLineStatus(Uart);
+    UART_EnableIT(Uart, UART_IT_RxData | UART_IT_RxLineStatus);
+}
+
+
+/** @brief  Service the slave's UART interrupt
+  *
+  * @param  [in]  MB       Slave state
+  *
+  * @return None.
+  */
+void Modbus_UARTIRQHandler(Modbus_Type *MB)
+{
+    UART_Type *Uart = MB->Uart;
+    uint16_t ITID;
+
+
+    while ((ITID = UART_GetPendingITID(Uart)) != UART_ITID_None) {
+        switch (ITID) {
+            case UART_ITID_RxLineStatus:
+                /* Parity / framing / overrun: the frame is no good */
+                if (UART_GetLineStatus(Uart) & (UART_LineStatus_RxOverrun
+                                                | UART_LineStatus_ParityError
+                                                | UART_LineStatus_FramingError
+                                                | UART_LineStatus_Break))
+                {
+                    if (MB->State == Modbus_State_Receiving) {
+                        MB->Bad = 1;
+                    }
+                }
+                Modbus_DrainRxFifo(MB);
+                break;
+
+            case UART_ITID_RxDataAvailable:
+            case UART_ITID_CharacterTimeOut:
+                Modbus_DrainRxFifo(MB);
+                break;
+
+            case UART_ITID_TxEmpty:
+                Modbus_FillTxFifo(MB);
+                break;
+
+            case UART_ITID_ModemStatus:
+                UART_GetModemStatus(Uart);
+                break;
+
+            default:
+                return;
+        }
+    }
+}
+
+
+/** @brief  Service the slave's TIMER interrupt (end of frame)
+  *
+  * @param  [in]  MB       Slave state
+  *
+  * @return None.
+  */
+void Modbus_TimerIRQHandler(Modbus_Type *MB)
+{
+    uint16_t Len;
+
+
+    TIMER_ClearPendingIT(MB->Timer, TIMER_IT_MR0);
+
+    if (MB->State == Modbus_State_Transmitting) {
+        /* t3.5 after the last FIFO load; if the interrupt was late enough
+         *  that the shifter still isn't done, give it another t3.5.
+         */
+        if (!(UART_GetLineStatus(MB->Uart) & UART_LineStatus_TxEmpty)) {
+            Modbus_StartT35(MB);
+            return;
+        }
+
+        /* Done talking: throw away our echo and listen again */
+        UART_FlushRxFifo(MB->Uart);
+        MB->State = Modbus_State_Idle;
+        return;
+    }
+
+    if (MB->State != Modbus_State_Receiving) {
+        return;
+    }
+
+    /* t3.5 of silence: the frame is complete */
+    MB->State = Modbus_State_Idle;
+    Len = MB->Len;
+
+    if (MB->Bad || (Len < 4)) {
+        MB->Errors++;
+        return;
+    }
+
+    if (MB->Crc != 0) {
+        MB->CrcErrors++;
+        return;
+    }
+
+    if ((MB->Buf[0] != MB->Address) && (MB->Buf[0] != MODBUS_BROADCAST)) {
+        return;
+    }
+
+    MB->Frames++;
+
+    Len = Modbus_Process(MB, Len - 2);
+
+    /* No answers to broadcasts */
+    if (MB->Buf[0] == MODBUS_BROADCAST) {
+        return;
+    }
+
+    MB->Crc = Modbus_CRC(0xffff, MB->Buf, Len);
+    MB->Buf[Len++] = MB->Crc & 0xff;
+    MB->Buf[Len++] = MB->Crc >> 8;
+
+    /* Send it straight out of Buf; the bus is quiet and so is the FIFO */
+    MB->TxData = MB->Buf;
+    MB->TxLeft = Len;
+    MB->State  = Modbus_State_Transmitting;
+
+    Modbus_FillTxFifo(MB);
+    UART_EnableIT(MB->Uart, UART_IT_TxData);
+}
+
+#endif /* #ifdef LPC2XXX_HAS_TIMER */
+
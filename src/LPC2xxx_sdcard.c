@@ -0,0 +1,479 @@
+/******************************************************************************
+ * @file:    LPC2xxx_sdcard.c
+ * @purpose: SD / MMC Card Block Access Over SSP
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+#if defined(LPC2XXX_HAS_SSP) && defined(LPC2XXX_HAS_GPIO)
+
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_gpio.h"
+#include "LPC2xxx_sdcard.h"
+#include "LPC2xxx_lib_assert.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#define SDCARD_ACMD              (0x80)    /* Command needs CMD55 first      */
+
+#define SDCARD_CMD_GO_IDLE       (0)
+#define SDCARD_CMD_SEND_OP_COND  (1)       /* MMC                            */
+#define SDCARD_CMD_SEND_IF_COND  (8)
+#define SDCARD_CMD_STOP          (12)
+#define SDCARD_CMD_SET_BLOCKLEN  (16)
+#define SDCARD_CMD_READ_SINGLE   (17)
+#define SDCARD_CMD_READ_MULTIPLE (18)
+#define SDCARD_CMD_WRITE_SINGLE  (24)
+#define SDCARD_CMD_WRITE_MULTI   (25)
+#define SDCARD_CMD_APP           (55)
+#define SDCARD_CMD_READ_OCR      (58)
+#define SDCARD_ACMD_SET_WR_ERASE (SDCARD_ACMD | 23)
+#define SDCARD_ACMD_SEND_OP_COND (SDCARD_ACMD | 41)
+
+#define SDCARD_R1_IDLE           (0x01)
+#define SDCARD_R1_ILLEGAL_CMD    (0x04)
+
+#define SDCARD_TOKEN_START       (0xfe)    /* Single / read block data start */
+#define SDCARD_TOKEN_START_MULTI (0xfc)    /* CMD25 block data start         */
+#define SDCARD_TOKEN_STOP_MULTI  (0xfd)    /* End of CMD25 data              */
+#define SDCARD_DATA_RESP_MASK    (0x1f)
+#define SDCARD_DATA_ACCEPTED     (0x05)
+
+/** @brief  Clock one byte each way
+  * @param  SD      Card state
+  * @param  Out     Byte to send
+  * @return Byte received
+  */
+static inline uint8_t SDCard_Xfer(SDCard_Type *SD, uint8_t Out)
+{
+    return SSP_Xfer(SD->SSP, Out);
+}
+
+/** @brief  Wait for the card to stop holding DO low
+  * @param  SD      Card state
+  * @return 1 if ready, 0 on timeout
+  */
+static uint8_t SDCard_WaitReady(SDCard_Type *SD)
+{
+    uint32_t Tries = SDCARD_BUSY_TRIES;
+
+
+    while (SDCard_Xfer(SD, 0xff) != 0xff) {
+        if (--Tries == 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/** @brief  Drive CS low and wait for the card to be ready
+  * @param  SD      Card state
+  * @return 1 if ready, 0 on timeout (CS is left low either way)
+  */
+static uint8_t SDCard_Select(SDCard_Type *SD)
+{
+    GPIO_ClearPins(SD->CSPort, SD->CSPin);
+
+    return SDCard_WaitReady(SD);
+}
+
+/** @brief  Drive CS high and clock out a byte so the card lets go of DO
+  * @param  SD      Card state
+  * @return None.
+  */
+static void SDCard_Deselect(SDCard_Type *SD)
+{
+    GPIO_SetPins(SD->CSPort, SD->CSPin);
+    SDCard_Xfer(SD, 0xff);
+}
+
+/** @brief  Send a command and get its R1 response
+  * @param  SD      Card state (selected)
+  * @param  Cmd     Command index (| SDCARD_ACMD for app commands)
+  * @param  Arg     Command argument
+  * @return R1 response; 0xff if none came
+  */
+static uint8_t SDCard_Command(SDCard_Type *SD, uint8_t Cmd, uint32_t Arg)
+{
+    uint8_t Frame[6];
+    uint8_t R1;
+    uint8_t Tries;
+
+
+    if (Cmd & SDCARD_ACMD) {
+        R1 = SDCard_Command(SD, SDCARD_CMD_APP, 0);
+        if (R1 > SDCARD_R1_IDLE) {
+            return R1;
+        }
+        Cmd &= ~SDCARD_ACMD;
+    }
+
+    Frame[0] = 0x40 | Cmd;
+    Frame[1] = Arg >> 24;
+    Frame[2] = Arg >> 16;
+    Frame[3] = Arg >> 8;
+    Frame[4] = Arg;
+
+    /* CRCs are only checked until the card is in SPI mode */
+    if (Cmd == SDCARD_CMD_GO_IDLE) {
+        Frame[5] = 0x95;
+    } else if (Cmd == SDCARD_CMD_SEND_IF_COND) {
+        Frame[5] = 0x87;
+    } else {
+        Frame[5] = 0x01;
+    }
+
+    SSP_WriteBlock(SD->SSP, Frame, 6);
+
+    if (Cmd == SDCARD_CMD_STOP) {
+        SDCard_Xfer(SD, 0xff);          /* Stuff byte */
+    }
+
+    Tries = 10;
+    do {
+        R1 = SDCard_Xfer(SD, 0xff);
+    } while ((R1 & 0x80) && --Tries);
+
+    return R1;
+}
+
+/** @brief  Send a command on its own: select, command, deselect
+  * @param  SD      Card state
+  * @param  Cmd     Command index (| SDCARD_ACMD for app commands)
+  * @param  Arg     Command argument
+  * @param  Resp    Where to put the 4 bytes following R1 (R3 / R7), or NULL
+  * @return R1 response; 0xff if none came
+  */
+static uint8_t SDCard_Simple(SDCard_Type *SD, uint8_t Cmd, uint32_t Arg, uint8_t *Resp)
+{
+    uint8_t R1 = 0xff;
+
+
+    /* A card that's still in SD mode may not look ready; just reset it */
+    if (Cmd == SDCARD_CMD_GO_IDLE) {
+        GPIO_ClearPins(SD->CSPort, SD->CSPin);
+        R1 = SDCard_Command(SD, Cmd, Arg);
+    } else if (SDCard_Select(SD)) {
+        R1 = SDCard_Command(SD, Cmd, Arg);
+        if (Resp) {
+            SSP_ReadBlock(SD->SSP, Resp, 4);
+        }
+    }
+
+    SDCard_Deselect(SD);
+
+    return R1;
+}
+
+/** @brief  Read one data block following a read command
+  * @param  SD      Card state (selected)
+  * @param  Data    Where to put the block
+  * @return SDCard_Result_OK on success
+  */
+static SDCard_Result_Type SDCard_RecvBlock(SDCard_Type *SD, uint8_t *Data)
+{
+    uint32_t Tries = SDCARD_READ_TRIES;
+    uint8_t Token;
+
+
+    while ((Token = SDCard_Xfer(SD, 0xff)) == 0xff) {
+        if (--Tries == 0) {
+            return SDCard_Result_Timeout;
+        }
+    }
+
+    if (Token != SDCARD_TOKEN_START) {
+        return SDCard_Result_DataError;
+    }
+
+    SSP_ReadBlock(SD->SSP, Data, SDCARD_BLOCK_SIZE);
+    SSP_ReadBlock(SD->SSP, 0, 2);       /* CRC */
+
+    return SDCard_Result_OK;
+}
+
+/** @brief  Send one data block and wait for the card to program it
+  * @param  SD      Card state (selected)
+  * @param  Token   Start token for the block
+  * @param  Data    The block
+  * @return SDCard_Result_OK on success
+  */
+static SDCard_Result_Type SDCard_SendBlock(SDCard_Type *SD, uint8_t Token, const uint8_t *Data)
+{
+    SDCard_Xfer(SD, Token);
+    SSP_WriteBlock(SD->SSP, Data, SDCARD_BLOCK_SIZE);
+    SSP_ReadBlock(SD->SSP, 0, 2);       /* CRC (not checked) */
+
+    if ((SDCard_Xfer(SD, 0xff) & SDCARD_DATA_RESP_MASK) != SDCARD_DATA_ACCEPTED) {
+        return SDCard_Result_DataError;
+    }
+
+    if (!SDCard_WaitReady(SD)) {
+        return SDCard_Result_Timeout;
+    }
+
+    return SDCard_Result_OK;
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Identify and set up a card
+  *
+  * @param  [out] SD       Card state to initialize
+  * @param  [in]  SSP      The SSP the card is on
+  * @param  [in]  CSPort   Chip select GPIO port
+  * @param  [in]  CSPin    Chip select pin (as a mask)
+  *
+  * @return SDCard_Result_OK if the card is ready for use.
+  */
+SDCard_Result_Type SDCard_Init(SDCard_Type *SD, SSP_Type *SSP,
+                               GPIO_Type *CSPort, uint32_t CSPin)
+{
+    uint8_t Resp[4];
+    uint8_t Cmd;
+    uint32_t Arg;
+    uint32_t Tries;
+    uint8_t R1;
+
+
+    SD->SSP    = SSP;
+    SD->CSPort = CSPort;
+    SD->CSPin  = CSPin;
+    SD->Kind   = SDCard_Kind_None;
+
+    SSP_Disable(SSP);
+    SSP_SetMode(SSP, SSP_Mode_Master);
+    SSP_SetWordSize(SSP, SSP_WordLength_8);
+    SSP_SetFrameFormat(SSP, SSP_FrameFormat_SPI);
+    SSP_SetClockPolarity(SSP, SSP_ClockPolarity_Low);
+    SSP_SetClockPhase(SSP, SSP_ClockPhase_A);
+    SD->Hz = SSP_SetClockFrequency(SSP, SDCARD_INIT_HZ);
+    SSP_Enable(SSP);
+
+    /* At least 74 clocks with CS high to wake the card up */
+    GPIO_SetPins(CSPort, CSPin);
+    SSP_ReadBlock(SSP, 0, 10);
+
+    if (SDCard_Simple(SD, SDCARD_CMD_GO_IDLE, 0, 0) != SDCARD_R1_IDLE) {
+        return SDCard_Result_NoCard;
+    }
+
+    /* SDv2 cards echo the check pattern back; older cards don't know CMD8 */
+    R1 = SDCard_Simple(SD, SDCARD_CMD_SEND_IF_COND, 0x1aa, Resp);
+    if (R1 == SDCARD_R1_IDLE) {
+        if ((Resp[2] & 0x0f) != 0x01 || Resp[3] != 0xaa) {
+            return SDCard_Result_Unusable;
+        }
+        SD->Kind = SDCard_Kind_SDv2;
+        Cmd = SDCARD_ACMD_SEND_OP_COND;
+        Arg = 1UL << 30;                /* We handle high capacity cards */
+    } else {
+        SD->Kind = SDCard_Kind_SDv1;
+        Cmd = SDCARD_ACMD_SEND_OP_COND;
+        Arg = 0;
+    }
+
+    Tries = SDCARD_INIT_TRIES;
+    while ((R1 = SDCard_Simple(SD, Cmd, Arg, 0)) != 0) {
+        if ((R1 & SDCARD_R1_ILLEGAL_CMD) && (SD->Kind == SDCard_Kind_SDv1)) {
+            /* Not an SD card at all */
+            SD->Kind = SDCard_Kind_MMC;
+            Cmd = SDCARD_CMD_SEND_OP_COND;
+        } else if ((R1 != SDCARD_R1_IDLE) || (--Tries == 0)) {
+            SD->Kind = SDCard_Kind_None;
+            return (R1 == SDCARD_R1_IDLE) ? SDCard_Result_Timeout
+                                          : SDCard_Result_Unusable;
+        }
+    }
+
+    if (SD->Kind == SDCard_Kind_SDv2) {
+        if (SDCard_Simple(SD, SDCARD_CMD_READ_OCR, 0, Resp) != 0) {
+            SD->Kind = SDCard_Kind_None;
+            return SDCard_Result_CommandError;
+        }
+        if (Resp[0] & 0x40) {
+            SD->Kind = SDCard_Kind_SDHC;
+        }
+    }
+
+    if ((SD->Kind != SDCard_Kind_SDHC)
+     && (SDCard_Simple(SD, SDCARD_CMD_SET_BLOCKLEN, SDCARD_BLOCK_SIZE, 0) != 0))
+    {
+        SD->Kind = SDCard_Kind_None;
+        return SDCard_Result_CommandError;
+    }
+
+    /* MMC tops out at 20MHz in SPI mode */
+    SSP_Disable(SSP);
+    SD->Hz = SSP_SetClockFrequency(SSP, (SD->Kind == SDCard_Kind_MMC) ? 20000000
+                                                                     : SDCARD_MAX_HZ);
+    SSP_Enable(SSP);
+
+    return SDCard_Result_OK;
+}
+
+
+/** @brief  Read blocks from the card
+  *
+  * @param  [in]  SD       Card state
+  * @param  [in]  Block    First block to read
+  * @param  [out] Data     Where to put the data (Count * 512 bytes)
+  * @param  [in]  Count    Number of blocks (at least 1)
+  *
+  * @return SDCard_Result_OK on success.
+  */
+SDCard_Result_Type SDCard_ReadBlocks(SDCard_Type *SD, uint32_t Block,
+                                     void *Data, uint32_t Count)
+{
+    SDCard_Result_Type Result = SDCard_Result_OK;
+    uint8_t *Dst = Data;
+
+
+    lpc2xxx_lib_assert(SD->Kind != SDCard_Kind_None);
+    lpc2xxx_lib_assert(Count != 0);
+
+    if (SD->Kind != SDCard_Kind_SDHC) {
+        Block *= SDCARD_BLOCK_SIZE;
+    }
+
+    if (!SDCard_Select(SD)) {
+        Result = SDCard_Result_Timeout;
+    } else if (Count == 1) {
+        if (SDCard_Command(SD, SDCARD_CMD_READ_SINGLE, Block) != 0) {
+            Result = SDCard_Result_CommandError;
+        } else {
+            Result = SDCard_RecvBlock(SD, Dst);
+        }
+    } else if (SDCard_Command(SD, SDCARD_CMD_READ_MULTIPLE, Block) != 0) {
+        Result = SDCard_Result_CommandError;
+    } else {
+        while (Count--) {
+            Result = SDCard_RecvBlock(SD, Dst);
+            if (Result != SDCard_Result_OK) {
+                break;
+            }
+            Dst += SDCARD_BLOCK_SIZE;
+        }
+
+        SDCard_Command(SD, SDCARD_CMD_STOP, 0);
+        if (!SDCard_WaitReady(SD) && (Result == SDCard_Result_OK)) {
+            Result = SDCard_Result_Timeout;
+        }
+    }
+
+    SDCard_Deselect(SD);
+
+    return Result;
+}
+
+
+/** @brief  Write blocks to the card
+  *
+  * @param  [in]  SD       Card state
+  * @param  [in]  Block    First block to write
+  * @param  [in]  Data     Data to write (Count * 512 bytes)
+  * @param  [in]  Count    Number of blocks (at least 1)
+  *
+  * @return SDCard_Result_OK on success.
+  */
+SDCard_Result_Type SDCard_WriteBlocks(SDCard_Type *SD, uint32_t Block,
+                                      const void *Data, uint32_t Count)
+{
+    SDCard_Result_Type Result = SDCard_Result_OK;
+    const uint8_t *Src = Data;
+
+
+    lpc2xxx_lib_assert(SD->Kind != SDCard_Kind_None);
+    lpc2xxx_lib_assert(Count != 0);
+
+    if (SD->Kind != SDCard_Kind_SDHC) {
+        Block *= SDCARD_BLOCK_SIZE;
+    }
+
+    if (!SDCard_Select(SD)) {
+        Result = SDCard_Result_Timeout;
+    } else if (Count == 1) {
+        if (SDCard_Command(SD, SDCARD_CMD_WRITE_SINGLE, Block) != 0) {
+            Result = SDCard_Result_CommandError;
+        } else {
+            Result = SDCard_SendBlock(SD, SDCARD_TOKEN_START, Src);
+        }
+    } else {
+        /* Pre-erase hint; only a hint, so a failure doesn't matter */
+        if (SD->Kind != SDCard_Kind_MMC) {
+            SDCard_Command(SD, SDCARD_ACMD_SET_WR_ERASE, Count);
+        }
+
+        if (SDCard_Command(SD, SDCARD_CMD_WRITE_MULTI, Block) != 0) {
+            Result = SDCard_Result_CommandError;
+        } else {
+            while (Count--) {
+                Result = SDCard_SendBlock(SD, SDCARD_TOKEN_START_MULTI, Src);
+                if (Result != SDCard_Result_OK) {
+                    break;
+                }
+                Src += SDCARD_BLOCK_SIZE;
+            }
+
+            SDCard_Xfer(SD, SDCARD_TOKEN_STOP_MULTI);
+            SDCard_Xfer(SD, 0xff);
+            if (!SDCard_WaitReady(SD) && (Result == SDCard_Result_OK)) {
+                Result = SDCard_Result_Timeout;
+            }
+        }
+    }
+
+    SDCard_Deselect(SD);
+
+    return Result;
+}
+
+#endif /* #if defined(LPC2XXX_HAS_SSP) && defined(LPC2XXX_HAS_GPIO) */
+
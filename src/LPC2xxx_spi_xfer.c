@@ -0,0 +1,216 @@
+/******************************************************************************
+ * @file:    LPC2xxx_spi_xfer.c
+ * @purpose: Interrupt-Driven SPI Block Transfers
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+#ifdef LPC2XXX_HAS_SPI
+
+#include "LPC2xxx_spi.h"
+#include "LPC2xxx_spi_xfer.h"
+#include "LPC2xxx_lib_assert.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief  Put the next frame on the wire
+  * @param  X       Transfer state
+  * @return None.
+  */
+static inline void SPIXfer_SendNext(SPIXfer_Type *X)
+{
+    uint16_t Word;
+
+
+    if (X->Tx == 0) {
+        Word = 0xffff;
+    } else if (X->Wide) {
+        Word = *(const uint16_t *)X->Tx;
+        X->Tx += 2;
+    } else {
+        Word = *X->Tx++;
+    }
+
+    SPI_Send(X->SPI, Word);
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Set up an SPI for interrupt-driven block transfers
+  *
+  * @param  [out] X        Transfer state to initialize
+  * @param  [in]  SPI      The SPI to use (already set up as master)
+  *
+  * @return None.
+  */
+void SPIXfer_Init(SPIXfer_Type *X, SPI_Type *SPI)
+{
+    lpc2xxx_lib_assert(SPI_GetMode(SPI) == SPI_Mode_Master);
+
+    SPI_DisableIT(SPI);
+
+    X->SPI    = SPI;
+    X->Tx     = 0;
+    X->Rx     = 0;
+    X->Left   = 0;
+    X->Wide   = 0;
+    X->Status = 0;
+    X->Done   = 0;
+    X->Arg    = 0;
+    X->Busy   = 0;
+
+    /* Reading the status then the data register clears any stale SPIF */
+    SPI_GetStatus(SPI);
+    SPI_Recv(SPI);
+    SPI_ClearPendingIT(SPI);
+}
+
+
+/** @brief  Start moving a block of frames
+  *
+  * @param  [in]  X        Transfer state
+  * @param  [in]  TxData   Frames to send (NULL sends all ones)
+  * @param  [out] RxData   Frames received (NULL drops them)
+  * @param  [in]  Count    Number of frames (at least 1)
+  * @param  [in]  Done     Called (from the ISR) once the last frame is in
+  * @param  [in]  Arg      Passed to Done
+  *
+  * @return 1 if the transfer was started, 0 if one is already running.
+  */
+uint8_t SPIXfer_Start(SPIXfer_Type *X, const void *TxData, void *RxData,
+                      uint16_t Count, SPIXfer_Callback_Type Done, void *Arg)
+{
+    SPI_Type *SPI = X->SPI;
+
+
+    lpc2xxx_lib_assert(Count != 0);
+
+    if (X->Busy) {
+        return 0;
+    }
+
+    /* The alternate length field reads 0 for 16 bits */
+    X->Wide   = (SPI_AltWordLengthIsEnabled(SPI)
+                 && (SPI_GetAltWordLength(SPI) != SPI_WordLength_8)) ? 1:0;
+    X->Tx     = TxData;
+    X->Rx     = RxData;
+    X->Left   = Count;
+    X->Status = 0;
+    X->Done   = Done;
+    X->Arg    = Arg;
+    X->Busy   = 1;
+
+    /* Nothing can interrupt until the first frame is written */
+    SPI_EnableIT(SPI);
+    SPIXfer_SendNext(X);
+
+    return 1;
+}
+
+
+/** @brief  Service the SPI's interrupt
+  *
+  * @param  [in]  X        Transfer state
+  *
+  * @return None.
+  */
+void SPIXfer_IRQHandler(SPIXfer_Type *X)
+{
+    SPI_Type *SPI = X->SPI;
+    uint8_t Status;
+    uint16_t Word;
+
+
+    /* Status then data: this is what clears SPIF */
+    Status = SPI_GetStatus(SPI);
+    Word = SPI_Recv(SPI);
+    SPI_ClearPendingIT(SPI);
+
+    if (!X->Busy) {
+        SPI_DisableIT(SPI);
+        return;
+    }
+
+    X->Status |= Status & (SPI_Status_Abort | SPI_Status_ModeFault
+                           | SPI_Status_ReadOverrun | SPI_Status_WriteCollision);
+
+    if (Status & SPI_Status_ModeFault) {
+        /* Someone else drove SSEL; a write to CR clears the fault, and
+         *  there's no point going on with the transfer.
+         */
+        SPI->CR = SPI->CR;
+        X->Left = 0;
+    } else if (Status & SPI_Status_XferComplete) {
+        if (X->Rx) {
+            if (X->Wide) {
+                *(uint16_t *)X->Rx = Word;
+                X->Rx += 2;
+            } else {
+                *X->Rx++ = Word;
+            }
+        }
+
+        if (--X->Left) {
+            SPIXfer_SendNext(X);
+            return;
+        }
+    } else {
+        return;
+    }
+
+    SPI_DisableIT(SPI);
+    X->Busy = 0;
+
+    if (X->Done) {
+        X->Done(X->Arg);
+    }
+}
+
+#endif /* #ifdef LPC2XXX_HAS_SPI */
+
@@ -0,0 +1,308 @@
+/******************************************************************************
+ * @file:    LPC2xxx_spiflash.c
+ * @purpose: 25-Series SPI NOR Flash Over SSP
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+#if defined(LPC2XXX_HAS_SSP) && defined(LPC2XXX_HAS_GPIO)
+
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_gpio.h"
+#include "LPC2xxx_spiflash.h"
+#include "LPC2xxx_lib_assert.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief  Run one command
+  * @param  F       Flash state
+  * @param  Cmd     Command byte
+  * @param  Addr    24 bit address to send after it
+  * @param  HdrLen  Bytes of header: 1 (command only), 4 (with address) or
+  *                  5 (with address and a dummy byte)
+  * @param  TxData  Data to send after the header (NULL = ones)
+  * @param  RxData  Where to put data received after the header (or NULL)
+  * @param  Len     Bytes of data after the header
+  * @return None.
+  */
+static void SPIFlash_Command(SPIFlash_Type *F, uint8_t Cmd, uint32_t Addr, uint8_t HdrLen,
+                             const void *TxData, void *RxData, uint32_t Len)
+{
+    uint8_t Hdr[5];
+
+
+    Hdr[0] = Cmd;
+    Hdr[1] = Addr >> 16;
+    Hdr[2] = Addr >> 8;
+    Hdr[3] = Addr;
+    Hdr[4] = 0xff;
+
+    GPIO_ClearPins(F->CSPort, F->CSPin);
+
+    SSP_WriteBlock(F->SSP, Hdr, HdrLen);
+    if (Len) {
+        SSP_XferBlock(F->SSP, TxData, RxData, Len);
+    }
+
+    GPIO_SetPins(F->CSPort, F->CSPin);
+}
+
+/** @brief  Read the status register
+  * @param  F       Flash state
+  * @return Status register 1
+  */
+static uint8_t SPIFlash_ReadStatus(SPIFlash_Type *F)
+{
+    uint8_t Status;
+
+
+    SPIFlash_Command(F, SPIFLASH_CMD_READ_STATUS, 0, 1, 0, &Status, 1);
+
+    return Status;
+}
+
+/** @brief  Start programming the next (part) page of a write
+  * @param  F       Flash state
+  * @return None.
+  */
+static void SPIFlash_ProgramPage(SPIFlash_Type *F)
+{
+    uint32_t Len;
+
+
+    /* Programming wraps within a page, so never cross into the next */
+    Len = SPIFLASH_PAGE_SIZE - (F->WrAddr & (SPIFLASH_PAGE_SIZE - 1));
+    if (Len > F->WrLeft) {
+        Len = F->WrLeft;
+    }
+
+    SPIFlash_Command(F, SPIFLASH_CMD_WRITE_ENABLE, 0, 1, 0, 0, 0);
+    SPIFlash_Command(F, SPIFLASH_CMD_PAGE_PROGRAM, F->WrAddr, 4, F->WrData, 0, Len);
+
+    F->WrData += Len;
+    F->WrAddr += Len;
+    F->WrLeft -= Len;
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Set up access to an SPI flash chip
+  *
+  * @param  [out] F        Flash state to initialize
+  * @param  [in]  SSP      The SSP the chip is on (set up already)
+  * @param  [in]  CSPort   Chip select GPIO port
+  * @param  [in]  CSPin    Chip select pin (as a mask)
+  *
+  * @return The chip's JEDEC ID.
+  *
+  * Waits out any program / erase left running across a reset first.
+  */
+uint32_t SPIFlash_Init(SPIFlash_Type *F, SSP_Type *SSP, GPIO_Type *CSPort, uint32_t CSPin)
+{
+    uint8_t Id[3];
+    uint8_t Status;
+
+
+    lpc2xxx_lib_assert((SSP->CR0 & SSP_DSS_Mask) == SSP_DSS_8);
+
+    F->SSP       = SSP;
+    F->CSPort    = CSPort;
+    F->CSPin     = CSPin;
+    F->State     = SPIFlash_State_Idle;
+    F->WrLeft    = 0;
+    F->LineValid = 0;
+
+    GPIO_SetPins(CSPort, CSPin);
+
+    /* Might have been reset in the middle of something, in which case the
+     *  chip ignores everything but RDSR until it's done.  0xff is nothing
+     *  driving MISO at all.
+     */
+    do {
+        Status = SPIFlash_ReadStatus(F);
+    } while ((Status & SPIFLASH_STATUS_BUSY) && (Status != 0xff));
+
+    SPIFlash_Command(F, SPIFLASH_CMD_JEDEC_ID, 0, 1, 0, Id, 3);
+
+    return (Id[0] << 16) | (Id[1] << 8) | Id[2];
+}
+
+
+/** @brief  Read from the flash
+  *
+  * @param  [in]  F        Flash state
+  * @param  [in]  Addr     Flash address to start at
+  * @param  [out] Data     Where to put the bytes
+  * @param  [in]  Len      Number of bytes
+  *
+  * @return None.
+  */
+void SPIFlash_Read(SPIFlash_Type *F, uint32_t Addr, void *Data, uint32_t Len)
+{
+    uint8_t *Dst = Data;
+    uint32_t Offset;
+    uint32_t Chunk;
+    uint32_t i;
+
+
+    while (SPIFlash_Poll(F));
+
+    while (Len) {
+        Offset = Addr - F->LineAddr;
+
+        if (F->LineValid && (Offset < SPIFLASH_LINE_SIZE)) {
+            Chunk = SPIFLASH_LINE_SIZE - Offset;
+            if (Chunk > Len) {
+                Chunk = Len;
+            }
+
+            for (i = 0; i < Chunk; i++) {
+                Dst[i] = F->Line[Offset + i];
+            }
+        } else if (Len >= SPIFLASH_LINE_SIZE) {
+            /* Big enough to be worth streaming straight to the caller */
+            SPIFlash_Command(F, SPIFLASH_CMD_FAST_READ, Addr, 5, 0, Dst, Len);
+            return;
+        } else {
+            SPIFlash_Command(F, SPIFLASH_CMD_FAST_READ, Addr, 5, 0,
+                             F->Line, SPIFLASH_LINE_SIZE);
+            F->LineAddr = Addr;
+            F->LineValid = 1;
+            continue;
+        }
+
+        Dst  += Chunk;
+        Addr += Chunk;
+        Len  -= Chunk;
+    }
+}
+
+
+/** @brief  Start programming data into (erased) flash
+  *
+  * @param  [in]  F        Flash state
+  * @param  [in]  Addr     Flash address to start at
+  * @param  [in]  Data     Bytes to program; must stay put until done
+  * @param  [in]  Len      Number of bytes (at least 1)
+  *
+  * @return 1 if started, 0 if the flash is busy.
+  */
+uint8_t SPIFlash_Write(SPIFlash_Type *F, uint32_t Addr, const void *Data, uint32_t Len)
+{
+    lpc2xxx_lib_assert(Len != 0);
+
+    if (SPIFlash_Poll(F)) {
+        return 0;
+    }
+
+    F->LineValid = 0;
+
+    F->WrData = Data;
+    F->WrAddr = Addr;
+    F->WrLeft = Len;
+    F->State  = SPIFlash_State_Programming;
+
+    SPIFlash_ProgramPage(F);
+
+    return 1;
+}
+
+
+/** @brief  Start erasing a 4K sector
+  *
+  * @param  [in]  F        Flash state
+  * @param  [in]  Addr     Any address in the sector
+  *
+  * @return 1 if started, 0 if the flash is busy.
+  */
+uint8_t SPIFlash_EraseSector(SPIFlash_Type *F, uint32_t Addr)
+{
+    if (SPIFlash_Poll(F)) {
+        return 0;
+    }
+
+    F->LineValid = 0;
+    F->State = SPIFlash_State_Erasing;
+
+    SPIFlash_Command(F, SPIFLASH_CMD_WRITE_ENABLE, 0, 1, 0, 0, 0);
+    SPIFlash_Command(F, SPIFLASH_CMD_SECTOR_ERASE, Addr & ~(SPIFLASH_SECTOR_SIZE - 1),
+                     4, 0, 0, 0);
+
+    return 1;
+}
+
+
+/** @brief  Move a program / erase along
+  *
+  * @param  [in]  F        Flash state
+  *
+  * @return 1 if still busy, 0 once idle.
+  */
+uint8_t SPIFlash_Poll(SPIFlash_Type *F)
+{
+    if (F->State == SPIFlash_State_Idle) {
+        return 0;
+    }
+
+    if (SPIFlash_ReadStatus(F) & SPIFLASH_STATUS_BUSY) {
+        return 1;
+    }
+
+    if (F->WrLeft) {
+        SPIFlash_ProgramPage(F);
+        return 1;
+    }
+
+    F->State = SPIFlash_State_Idle;
+
+    return 0;
+}
+
+#endif /* #if defined(LPC2XXX_HAS_SSP) && defined(LPC2XXX_HAS_GPIO) */
+
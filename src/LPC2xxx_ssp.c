@@ -0,0 +1,249 @@
+/******************************************************************************
+ * @file:    LPC2xxx_ssp.c
+ * @purpose: LPC2xxx SSP Block Transfer Functions
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+#ifdef LPC2XXX_HAS_SSP
+
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_syscon.h"
+#include "system_LPC2xxx.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief  Pipelined transfer loop
+  * @param  SSP     The SSP device
+  * @param  TxData  Frames to send, or NULL for all ones
+  * @param  RxData  Where to put received frames, or NULL
+  * @param  Count   Number of frames
+  * @param  Wide    1 for uint16_t frames, 0 for uint8_t (constant)
+  * @return None.
+  */
+static inline void SSP_XferBlockLoop(SSP_Type *SSP, const void *TxData, void *RxData,
+                                     uint32_t Count, uint8_t Wide)
+{
+    const uint8_t *Tx8 = TxData;
+    const uint16_t *Tx16 = TxData;
+    uint8_t *Rx8 = RxData;
+    uint16_t *Rx16 = RxData;
+    uint32_t TxLeft = Count;
+    uint32_t RxLeft = Count;
+    uint16_t Word;
+
+
+    while (RxLeft) {
+        /* Top up the Tx FIFO, but with no more than a FIFO's worth in
+         *  flight; any more and the Rx FIFO could overrun.
+         */
+        while (TxLeft && ((RxLeft - TxLeft) < SSP_FifoSize) && SSP_TxIsReady(SSP)) {
+            if (TxData == 0) {
+                Word = 0xffff;
+            } else if (Wide) {
+                Word = *Tx16++;
+            } else {
+                Word = *Tx8++;
+            }
+
+            SSP_Send(SSP, Word);
+            TxLeft--;
+        }
+
+        while (SSP_RxIsAvailable(SSP)) {
+            Word = SSP_Recv(SSP);
+
+            if (RxData != 0) {
+                if (Wide) {
+                    *Rx16++ = Word;
+                } else {
+                    *Rx8++ = Word;
+                }
+            }
+
+            RxLeft--;
+        }
+    }
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Send and Receive a Block of Frames, Keeping the FIFO Full
+  *
+  * @param  [in]  SSP      The SSP device (in master mode)
+  * @param  [in]  TxData   Frames to send, or NULL to send all ones
+  * @param  [out] RxData   Where to put received frames, or NULL to discard
+  * @param  [in]  Count    Number of frames
+  *
+  * @return None.
+  */
+void SSP_XferBlock(SSP_Type *SSP, const void *TxData, void *RxData, uint32_t Count)
+{
+    /* Let anything already queued finish, and drop its leftovers, so
+     *  received frames line up with the ones sent.
+     */
+    while (SSP_IsBusy(SSP));
+    while (SSP_RxIsAvailable(SSP)) {
+        SSP_Recv(SSP);
+    }
+
+    if ((SSP->CR0 & SSP_DSS_Mask) > SSP_DSS_8) {
+        SSP_XferBlockLoop(SSP, TxData, RxData, Count, 1);
+    } else {
+        SSP_XferBlockLoop(SSP, TxData, RxData, Count, 0);
+    }
+}
+
+
+/** @brief  Send a Block of Frames, Discarding What Comes Back
+  *
+  * @param  [in]  SSP      The SSP device (in master mode)
+  * @param  [in]  TxData   Frames to send
+  * @param  [in]  Count    Number of frames
+  *
+  * @return None.
+  */
+void SSP_WriteBlock(SSP_Type *SSP, const void *TxData, uint32_t Count)
+{
+    SSP_XferBlock(SSP, TxData, 0, Count);
+}
+
+
+/** @brief  Receive a Block of Frames, Sending All Ones
+  *
+  * @param  [in]  SSP      The SSP device (in master mode)
+  * @param  [out] RxData   Where to put received frames
+  * @param  [in]  Count    Number of frames
+  *
+  * @return None.
+  */
+void SSP_ReadBlock(SSP_Type *SSP, void *RxData, uint32_t Count)
+{
+    SSP_XferBlock(SSP, 0, RxData, Count);
+}
+
+/** @brief  Find the Fastest SCK Settings Not Over a Target Rate
+  *
+  * @param  [in]  PClk      The SSP's APB clock (Hz)
+  * @param  [in]  Hz        Highest acceptable SCK rate
+  * @param  [out] Prescaler Where to put the CPSDVSR value
+  * @param  [out] Rate      Where to put the SCR value
+  *
+  * @return The SCK rate the settings give, or 0 if Hz can't be reached.
+  */
+uint32_t SSP_CalcClock(uint32_t PClk, uint32_t Hz,
+                       SSP_ClockPrescaler_Type *Prescaler, SSP_ClockRate_Type *Rate)
+{
+    uint32_t Divider;
+    uint32_t Cps;
+    uint32_t Scr;
+    uint32_t Best = 0xffffffff;
+    uint32_t BestCps = 0;
+    uint32_t BestScr = 0;
+
+
+    lpc2xxx_lib_assert(Hz != 0);
+
+    Divider = (PClk + Hz - 1) / Hz;
+
+    if (Divider > 254 * 256) {
+        return 0;
+    }
+
+    /* SCK = PCLK / (CPSDVSR * (SCR + 1)), CPSDVSR even; start with the
+     *  smallest prescaler that can reach the divider.
+     */
+    for (Cps = 2 * ((Divider + 511) / 512); Cps <= 254; Cps += 2) {
+        Scr = (Divider + Cps - 1) / Cps;
+
+        if (Cps * Scr < Best) {
+            Best = Cps * Scr;
+            BestCps = Cps;
+            BestScr = Scr;
+
+            if (Best <= Divider + 1) {
+                break;              /* Can't do better: products are even */
+            }
+        }
+    }
+
+    *Prescaler = BestCps;
+    *Rate = BestScr - 1;
+
+    return PClk / Best;
+}
+
+
+/** @brief  Set SCK as Close to (but Not Over) a Target Rate as Possible
+  *
+  * @param  [in]  SSP      The SSP device
+  * @param  [in]  Hz       Highest acceptable SCK rate
+  *
+  * @return The SCK rate set, or 0 if Hz is too slow to reach.
+  */
+uint32_t SSP_SetClockFrequency(SSP_Type *SSP, uint32_t Hz)
+{
+    SSP_ClockPrescaler_Type Prescaler;
+    SSP_ClockRate_Type Rate;
+    uint32_t Actual;
+
+
+    Actual = SSP_CalcClock(SystemCoreClock / SYSCON_GetAPBClockDivider(), Hz,
+                           &Prescaler, &Rate);
+
+    if (Actual) {
+        SSP_SetClockPrescaler(SSP, Prescaler);
+        SSP_SetClockRate(SSP, Rate);
+    }
+
+    return Actual;
+}
+
+#endif /* #ifdef LPC2XXX_HAS_SSP */
+
@@ -0,0 +1,288 @@
+/******************************************************************************
+ * @file:    LPC2xxx_ssp_queue.c
+ * @purpose: Interrupt-Driven SSP Transaction Queue for LPC2xxx CPUs
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+#if defined(LPC2XXX_HAS_SSP) && defined(LPC2XXX_HAS_GPIO)
+
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_gpio.h"
+#include "LPC2xxx_vic.h"
+#include "LPC2xxx_ssp_queue.h"
+#include "LPC2xxx_lib_assert.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief  Load a device's SSP settings
+  * @param  SSP     The SSP
+  * @param  Config  Settings to load
+  * @return None.
+  */
+static void SSPQueue_LoadConfig(SSP_Type *SSP, const SSP_Init_Type *Config)
+{
+    lpc2xxx_lib_assert(Config->Mode == SSP_Mode_Master);
+
+    SSP_Disable(SSP);
+    SSP_SetWordSize(SSP, Config->WordLength);
+    SSP_SetFrameFormat(SSP, Config->FrameFormat);
+    SSP_SetClockPolarity(SSP, Config->ClockPolarity);
+    SSP_SetClockPhase(SSP, Config->ClockPhase);
+    SSP_SetClockRate(SSP, Config->ClockRate);
+    SSP_SetClockPrescaler(SSP, Config->ClockPrescaler);
+    SSP_Enable(SSP);
+}
+
+/** @brief  Take in everything waiting in the Rx FIFO
+  * @param  Q       Queue state
+  * @return None.
+  */
+static inline void SSPQueue_DrainRx(SSPQueue_Type *Q)
+{
+    SSP_Type *SSP = Q->SSP;
+    uint16_t Word;
+
+
+    while (SSP_RxIsAvailable(SSP)) {
+        Word = SSP_Recv(SSP);
+
+        if (Q->Rx) {
+            if (Q->Wide) {
+                *(uint16_t *)Q->Rx = Word;
+                Q->Rx += 2;
+            } else {
+                *Q->Rx++ = Word;
+            }
+        }
+
+        Q->RxLeft--;
+    }
+}
+
+/** @brief  Top up the Tx FIFO
+  * @param  Q       Queue state
+  * @return None.
+  *
+  * Keeps no more than a FIFO's worth of frames in flight so the Rx FIFO
+  *  can't overrun.  Turns off the Tx interrupt once everything's queued.
+  */
+static inline void SSPQueue_FillTx(SSPQueue_Type *Q)
+{
+    SSP_Type *SSP = Q->SSP;
+    uint16_t Word;
+
+
+    while (Q->TxLeft && ((Q->RxLeft - Q->TxLeft) < SSP_FifoSize)
+        && SSP_TxIsReady(SSP))
+    {
+        if (Q->Tx == 0) {
+            Word = 0xffff;
+        } else if (Q->Wide) {
+            Word = *(const uint16_t *)Q->Tx;
+            Q->Tx += 2;
+        } else {
+            Word = *Q->Tx++;
+        }
+
+        SSP_Send(SSP, Word);
+        Q->TxLeft--;
+    }
+
+    if (Q->TxLeft == 0) {
+        SSP_DisableIT(SSP, SSP_IT_TxHalfEmpty);
+    }
+}
+
+/** @brief  Start the transfer at the head of the queue
+  * @param  Q       Queue state
+  * @return None.
+  */
+static void SSPQueue_Start(SSPQueue_Type *Q)
+{
+    SSPQueue_Xfer_Type *X = Q->Head;
+
+
+    if (X->Config != Q->Config) {
+        SSPQueue_LoadConfig(Q->SSP, X->Config);
+        Q->Config = X->Config;
+    }
+
+    Q->Wide   = ((Q->SSP->CR0 & SSP_DSS_Mask) > SSP_DSS_8) ? 1:0;
+    Q->Tx     = X->TxData;
+    Q->Rx     = X->RxData;
+    Q->TxLeft = X->Count;
+    Q->RxLeft = X->Count;
+
+    if (X->CSPort) {
+        GPIO_ClearPins(X->CSPort, X->CSPin);
+    }
+
+    SSP_EnableIT(Q->SSP, SSP_IT_RxHalfFull | SSP_IT_RxTimer | SSP_IT_TxHalfEmpty);
+    SSPQueue_FillTx(Q);
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Set up an SSP for queued, interrupt-driven transfers
+  *
+  * @param  [out] Q        Queue state to initialize
+  * @param  [in]  SSP      The SSP to use
+  * @param  [in]  IRQn     The SSP's IRQ number (e.g. SSP0_IRQn)
+  *
+  * @return None.
+  */
+void SSPQueue_Init(SSPQueue_Type *Q, SSP_Type *SSP, IRQn_Type IRQn)
+{
+    VIC_DisableIRQ(IRQn);
+
+    Q->SSP    = SSP;
+    Q->IRQn   = IRQn;
+    Q->Head   = 0;
+    Q->Tail   = 0;
+    Q->Config = 0;
+    Q->Xfers  = 0;
+
+    SSP_Disable(SSP);
+    SSP_DisableIT(SSP, SSP_IT_RxOverrun | SSP_IT_RxTimer
+                       | SSP_IT_RxHalfFull | SSP_IT_TxHalfEmpty);
+    SSP_SetMode(SSP, SSP_Mode_Master);
+    SSP_Enable(SSP);
+
+    while (SSP_RxIsAvailable(SSP)) {
+        SSP_Recv(SSP);
+    }
+    SSP_ClearPendingIT(SSP, SSP_IT_RxOverrun | SSP_IT_RxTimer);
+
+    VIC_EnableIRQ(IRQn);
+}
+
+
+/** @brief  Queue a transfer
+  *
+  * @param  [in]  Q        Queue state
+  * @param  [in]  X        Transfer to run
+  *
+  * @return None.
+  */
+void SSPQueue_Submit(SSPQueue_Type *Q, SSPQueue_Xfer_Type *X)
+{
+    lpc2xxx_lib_assert(X->Config != 0);
+    lpc2xxx_lib_assert(X->Count != 0);
+
+    X->Next = 0;
+    X->Busy = 1;
+
+    VIC_DisableIRQ(Q->IRQn);
+
+    if (Q->Head == 0) {
+        Q->Head = X;
+        Q->Tail = X;
+        SSPQueue_Start(Q);
+    } else {
+        Q->Tail->Next = X;
+        Q->Tail = X;
+    }
+
+    VIC_EnableIRQ(Q->IRQn);
+}
+
+
+/** @brief  Service the SSP's interrupt
+  *
+  * @param  [in]  Q        Queue state
+  *
+  * @return None.
+  */
+void SSPQueue_IRQHandler(SSPQueue_Type *Q)
+{
+    SSP_Type *SSP = Q->SSP;
+    SSPQueue_Xfer_Type *X = Q->Head;
+
+
+    SSP_ClearPendingIT(SSP, SSP_IT_RxOverrun | SSP_IT_RxTimer);
+
+    if (X == 0) {
+        SSP_DisableIT(SSP, SSP_IT_RxHalfFull | SSP_IT_RxTimer | SSP_IT_TxHalfEmpty);
+        return;
+    }
+
+    SSPQueue_DrainRx(Q);
+    SSPQueue_FillTx(Q);
+
+    if (Q->RxLeft) {
+        return;
+    }
+
+    /* Finished: release the device, and get the next one going before
+     *  the callback so the bus isn't left idle.
+     */
+    if (X->CSPort) {
+        GPIO_SetPins(X->CSPort, X->CSPin);
+    }
+
+    Q->Xfers++;
+    Q->Head = X->Next;
+
+    if (Q->Head) {
+        SSPQueue_Start(Q);
+    } else {
+        Q->Tail = 0;
+        SSP_DisableIT(SSP, SSP_IT_RxHalfFull | SSP_IT_RxTimer | SSP_IT_TxHalfEmpty);
+    }
+
+    X->Busy = 0;
+
+    if (X->Done) {
+        X->Done(X->Arg);
+    }
+}
+
+#endif /* #if defined(LPC2XXX_HAS_SSP) && defined(LPC2XXX_HAS_GPIO) */
+
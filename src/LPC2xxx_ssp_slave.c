@@ -0,0 +1,236 @@
+/******************************************************************************
+ * @file:    LPC2xxx_ssp_slave.c
+ * @purpose: Interrupt-Driven SSP Slave with Double Buffered Responses
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+#ifdef LPC2XXX_HAS_SSP
+
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_vic.h"
+#include "LPC2xxx_ssp_slave.h"
+#include "LPC2xxx_lib_assert.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief  Move everything in the Rx FIFO into the ring
+  * @param  S       Slave state
+  * @return None.
+  */
+static inline void SSPSlave_DrainRx(SSPSlave_Type *S)
+{
+    SSP_Type *SSP = S->SSP;
+    uint16_t Head = S->RxHead;
+    uint8_t Byte;
+
+
+    while (SSP_RxIsAvailable(SSP)) {
+        Byte = SSP_Recv(SSP);
+
+        if ((uint16_t)(Head - S->RxTail) > S->RxMask) {
+            S->RxDropped++;
+        } else {
+            S->RxBuf[Head++ & S->RxMask] = Byte;
+        }
+    }
+
+    S->RxHead = Head;
+}
+
+/** @brief  Fill the Tx FIFO from the response buffers (or with filler)
+  * @param  S       Slave state
+  * @return None.
+  */
+static inline void SSPSlave_FillTx(SSPSlave_Type *S)
+{
+    SSP_Type *SSP = S->SSP;
+    uint8_t Next = S->TxNext;
+    uint16_t Pos = S->TxPos;
+
+
+    while (SSP_TxIsReady(SSP)) {
+        if (!S->TxReady[Next]) {
+            SSP_Send(SSP, S->Filler);
+            continue;
+        }
+
+        SSP_Send(SSP, S->TxBuf[Next][Pos++]);
+
+        if (Pos == S->TxLen[Next]) {
+            Pos = 0;
+            S->TxReady[Next] = 0;
+            Next ^= 1;
+        }
+    }
+
+    S->TxNext = Next;
+    S->TxPos = Pos;
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Start an SSP as an interrupt-driven slave
+  *
+  * @param  [out] S        Slave state to initialize
+  * @param  [in]  SSP      The SSP to use (frame settings already made)
+  * @param  [in]  IRQn     The SSP's IRQ number (e.g. SSP0_IRQn)
+  * @param  [in]  RxBuf    Receive ring storage
+  * @param  [in]  RxSize   Size of RxBuf (power of 2)
+  * @param  [in]  TxBufA   First response buffer
+  * @param  [in]  TxBufB   Second response buffer
+  * @param  [in]  TxSize   Size of each response buffer
+  * @param  [in]  Filler   Byte to send when no response is waiting
+  *
+  * @return None.
+  */
+void SSPSlave_Init(SSPSlave_Type *S, SSP_Type *SSP, IRQn_Type IRQn,
+                   uint8_t *RxBuf, uint16_t RxSize,
+                   uint8_t *TxBufA, uint8_t *TxBufB, uint16_t TxSize,
+                   uint8_t Filler)
+{
+    lpc2xxx_lib_assert(SSPSLAVE_IS_RING_SIZE(RxSize));
+    lpc2xxx_lib_assert((SSP->CR0 & SSP_DSS_Mask) == SSP_DSS_8);
+
+    VIC_DisableIRQ(IRQn);
+
+    S->SSP        = SSP;
+    S->IRQn       = IRQn;
+    S->RxBuf      = RxBuf;
+    S->RxMask     = RxSize - 1;
+    S->RxHead     = 0;
+    S->RxTail     = 0;
+    S->TxBuf[0]   = TxBufA;
+    S->TxBuf[1]   = TxBufB;
+    S->TxSize     = TxSize;
+    S->TxReady[0] = 0;
+    S->TxReady[1] = 0;
+    S->TxFill     = 0;
+    S->TxNext     = 0;
+    S->TxPos      = 0;
+    S->Filler     = Filler;
+    S->RxDropped  = 0;
+    S->Overruns   = 0;
+
+    /* The Tx FIFO can only be loaded while the SSP is enabled; as a slave
+     *  nothing moves until the master clocks, so that's safe.
+     */
+    SSP_Disable(SSP);
+    SSP_DisableIT(SSP, SSP_IT_RxOverrun | SSP_IT_RxTimer
+                       | SSP_IT_RxHalfFull | SSP_IT_TxHalfEmpty);
+    SSP_SetMode(SSP, SSP_Mode_Slave);
+    SSP_Enable(SSP);
+
+    while (SSP_RxIsAvailable(SSP)) {
+        SSP_Recv(SSP);
+    }
+    SSP_ClearPendingIT(SSP, SSP_IT_RxOverrun | SSP_IT_RxTimer);
+
+    SSPSlave_FillTx(S);
+
+    SSP_EnableIT(SSP, SSP_IT_RxOverrun | SSP_IT_RxTimer
+                      | SSP_IT_RxHalfFull | SSP_IT_TxHalfEmpty);
+
+    VIC_EnableIRQ(IRQn);
+}
+
+
+/** @brief  Retrieve received frames
+  *
+  * @param  [in]  S        Slave state
+  * @param  [out] Data     Where to store received bytes
+  * @param  [in]  Len      Maximum number of bytes to retrieve
+  *
+  * @return Number of bytes retrieved (0 if none were waiting).
+  */
+uint16_t SSPSlave_Read(SSPSlave_Type *S, uint8_t *Data, uint16_t Len)
+{
+    uint16_t Tail = S->RxTail;
+    uint16_t Avail = (uint16_t)(S->RxHead - Tail);
+    uint16_t i;
+
+
+    if (Len > Avail) {
+        Len = Avail;
+    }
+
+    for (i = 0; i < Len; i++) {
+        Data[i] = S->RxBuf[Tail++ & S->RxMask];
+    }
+
+    S->RxTail = Tail;
+
+    return Len;
+}
+
+
+/** @brief  Service the SSP's interrupt
+  *
+  * @param  [in]  S        Slave state
+  *
+  * @return None.
+  */
+void SSPSlave_IRQHandler(SSPSlave_Type *S)
+{
+    SSP_Type *SSP = S->SSP;
+
+
+    /* Rx first: at high SCK rates it's the one with no slack */
+    SSPSlave_DrainRx(S);
+
+    if (SSP_GetPendingIT(SSP) & SSP_IT_RxOverrun) {
+        S->Overruns++;
+    }
+    SSP_ClearPendingIT(SSP, SSP_IT_RxOverrun | SSP_IT_RxTimer);
+
+    SSPSlave_FillTx(S);
+}
+
+#endif /* #ifdef LPC2XXX_HAS_SSP */
+
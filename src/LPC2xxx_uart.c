@@ -0,0 +1,92 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart.c
+ * @purpose: Functions for Configuring UARTs on LPC2xxx CPUs
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+/* The run-time solver shares UART_CalcBaudConfigConst()'s body, rolled up */
+#define UART_BAUD_SOLVER_UNROLL
+
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart.h"
+#include "LPC2xxx_syscon.h"
+#include "system_LPC2xxx.h"
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Find the Minimum-Error Baud Rate Configuration
+  *
+  * @param  [in]  PClk     The UART's peripheral (APB) clock, in Hz
+  * @param  [in]  Baud     Desired baud rate
+  * @param  [out] Config   Where to store the resulting settings
+  *
+  * @return The baud rate actually achieved, or 0 if Baud is too high.
+  */
+uint32_t UART_CalcBaudConfig(uint32_t PClk, uint32_t Baud, UART_BaudConfig_Type *Config)
+{
+    lpc2xxx_lib_assert(Baud != 0);
+
+    return UART_CalcBaudConfigConst(PClk, Baud, Config);
+}
+
+
+/** @brief  Set a UART's Baud Rate Using the Current APB Clock
+  *
+  * @param  [in]  Uart     The UART to configure
+  * @param  [in]  Baud     Desired baud rate
+  *
+  * @return The baud rate actually achieved, or 0 if Baud is too high.
+  */
+uint32_t UART_SetBaudRate(UART_Type *Uart, uint32_t Baud)
+{
+    UART_BaudConfig_Type Config;
+    uint32_t Actual;
+
+
+    Actual = UART_CalcBaudConfig(SystemCoreClock / SYSCON_GetAPBClockDivider(),
+                                 Baud, &Config);
+
+    if (Actual != 0) {
+        UART_SetBaudConfig(Uart, &Config);
+    }
+
+    return Actual;
+}
+
@@ -0,0 +1,228 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart_autobaud.c
+ * @purpose: Interrupt-Driven UART Auto-Baud Detection for LPC2xxx CPUs
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+/* Nothing to build on parts without auto-baud hardware */
+#ifdef LPC2XXX_HAS_UART_AUTOBAUD
+
+#include "LPC2xxx_uart.h"
+#include "LPC2xxx_uart_autobaud.h"
+#include "LPC2xxx_syscon.h"
+#include "system_LPC2xxx.h"
+
+
+/* Variables ----------------------------------------------------------------*/
+
+/* Rates a measurement may be snapped to */
+static const uint32_t UARTAutoBaud_StdRates[] = {
+    1200, 2400, 4800, 9600, 14400, 19200, 28800, 38400, 57600,
+    76800, 115200, 230400, 250000, 460800, 500000, 921600, 1000000
+};
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief  Find the standard rate the hardware's measurement came from
+  * @param  PClk    UART clock
+  * @param  Divisor Divisor measured by the auto-baud hardware
+  * @return The matching standard rate, or 0 if none is close enough
+  *
+  * A standard rate matches if its ideal divisor is within 1 (the
+  *  measurement's resolution) plus 3% (host clock error) of the measured one.
+  */
+static uint32_t UARTAutoBaud_SnapRate(uint32_t PClk, uint16_t Divisor)
+{
+    uint32_t Best = 0;
+    uint64_t BestDiff = 0;
+    uint64_t Ideal = (uint64_t)PClk * 100;
+    uint64_t Measured;
+    uint64_t Diff;
+    uint32_t Rate;
+    unsigned int i;
+
+
+    for (i = 0; i < sizeof(UARTAutoBaud_StdRates) / sizeof(UARTAutoBaud_StdRates[0]); i++) {
+        Rate = UARTAutoBaud_StdRates[i];
+
+        /* All scaled by 1600 * Rate: |PClk / (16 * Rate) - Divisor| */
+        Measured = (uint64_t)1600 * Rate * Divisor;
+        Diff = (Measured > Ideal) ? (Measured - Ideal) : (Ideal - Measured);
+
+        if (Diff > (uint64_t)16 * Rate * (100 + 3 * (uint32_t)Divisor)) {
+            continue;
+        }
+
+        /* Compare relative to each rate's ideal divisor */
+        if ((Best == 0) || (Diff * Best < BestDiff * Rate)) {
+            Best = Rate;
+            BestDiff = Diff;
+        }
+    }
+
+    return Best;
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Start waiting for the host's character to measure its baud rate
+  *
+  * @param  [out] AB       Auto-baud state to initialize
+  * @param  [in]  Uart     The UART to measure
+  * @param  [in]  Mode     Measurement mode (UART_AutoBaudMode_0 for 'A'/'a')
+  * @param  [in]  Done     Called (from the ISR) once locked; may be NULL
+  *
+  * @return None.
+  */
+void UARTAutoBaud_Start(UARTAutoBaud_Type *AB, UART_Type *Uart,
+                        UART_AutoBaudMode_Type Mode,
+                        UARTAutoBaud_Callback_Type Done)
+{
+    AB->Uart     = Uart;
+    AB->PClk     = SystemCoreClock / SYSCON_GetAPBClockDivider();
+    AB->Done     = Done;
+    AB->Measured = 0;
+    AB->Rate     = 0;
+    AB->Actual   = 0;
+    AB->ErrorPPM = 0;
+    AB->State    = UARTAutoBaud_State_Running;
+
+    /* The hardware only measures whole divisors */
+    UART_SetFractionalDivider(Uart, 0, 1);
+
+    UART_ClearAutoBaudIT(Uart, UART_IT_AutoBaudEnd | UART_IT_AutoBaudTimeout);
+    UART_EnableIT(Uart, UART_IT_AutoBaudEnd | UART_IT_AutoBaudTimeout);
+    UART_StartAutoBaud(Uart, Mode, 1);
+}
+
+
+/** @brief  Abandon a running auto-baud detection
+  *
+  * @param  [in]  AB       Auto-baud state
+  *
+  * @return None.
+  */
+void UARTAutoBaud_Stop(UARTAutoBaud_Type *AB)
+{
+    UART_DisableIT(AB->Uart, UART_IT_AutoBaudEnd | UART_IT_AutoBaudTimeout);
+    UART_StopAutoBaud(AB->Uart);
+    UART_ClearAutoBaudIT(AB->Uart, UART_IT_AutoBaudEnd | UART_IT_AutoBaudTimeout);
+
+    if (AB->State == UARTAutoBaud_State_Running) {
+        AB->State = UARTAutoBaud_State_Idle;
+    }
+}
+
+
+/** @brief  Service the UART's auto-baud interrupts
+  *
+  * @param  [in]  AB       Auto-baud state for the interrupting UART
+  *
+  * @return None.
+  */
+void UARTAutoBaud_IRQHandler(UARTAutoBaud_Type *AB)
+{
+    UART_Type *Uart = AB->Uart;
+    UART_BaudConfig_Type Config;
+    uint16_t Divisor;
+    int64_t Num;
+    int64_t Den;
+
+
+    if (AB->State != UARTAutoBaud_State_Running) {
+        return;
+    }
+
+    UART_ClearAutoBaudIT(Uart, UART_IT_AutoBaudEnd | UART_IT_AutoBaudTimeout);
+
+    /* Still running => that was a timeout, and it's been restarted */
+    if (UART_AutoBaudIsRunning(Uart)) {
+        return;
+    }
+
+    UART_DisableIT(Uart, UART_IT_AutoBaudEnd | UART_IT_AutoBaudTimeout);
+
+    Divisor = UART_GetDivisor(Uart);
+    if (Divisor == 0) {
+        Divisor = 1;
+    }
+
+    AB->Measured = AB->PClk / (16 * (uint32_t)Divisor);
+
+    AB->Rate = UARTAutoBaud_SnapRate(AB->PClk, Divisor);
+    if (AB->Rate == 0) {
+        AB->Rate = AB->Measured;
+    }
+
+    /* Re-program for the rate the host is (most likely) really using */
+    if (UART_CalcBaudConfig(AB->PClk, AB->Rate, &Config) != 0) {
+        UART_SetBaudConfig(Uart, &Config);
+    } else {
+        Config.Divisor   = Divisor;
+        Config.DivAddVal = 0;
+        Config.MulVal    = 1;
+    }
+
+    AB->Actual = UART_CalcBaudRate(AB->PClk, &Config);
+
+    /* Exact error: PClk * MulVal / (16 * Div * (MulVal + DivAddVal)) vs. Rate */
+    Num = (int64_t)AB->PClk * Config.MulVal;
+    Den = (int64_t)16 * Config.Divisor * (Config.MulVal + Config.DivAddVal) * AB->Rate;
+    AB->ErrorPPM = (int32_t)(((Num - Den) * 1000000) / Den);
+
+    AB->State = UARTAutoBaud_State_Locked;
+
+    if (AB->Done) {
+        AB->Done(AB);
+    }
+}
+
+#endif /* #ifdef LPC2XXX_HAS_UART_AUTOBAUD */
+
@@ -0,0 +1,608 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart_buffered.c
+ * @purpose: Interrupt-Driven, Ring Buffered UART IO for LPC2xxx CPUs
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart.h"
+#include "LPC2xxx_vic.h"
+#include "LPC2xxx_uart_buffered.h"
+#include "LPC2xxx_lib_assert.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/* LSR bits that mean something went wrong on receive */
+#define UARTBUF_LINE_ERRORS  (UART_LineStatus_RxOverrun | UART_LineStatus_ParityError \
+                              | UART_LineStatus_FramingError | UART_LineStatus_Break)
+
+
+/** @brief  Record Rx line errors reported in LSR
+  * @param  UB      Buffered UART state
+  * @param  Lsr     Line status just read
+  * @return None.
+  *
+  * Reading LSR clears its error bits, so every read that might see them
+  *  passes them through here.
+  */
+static void UARTBuf_NoteLineErrors(UARTBuf_Type *UB, uint8_t Lsr)
+{
+    Lsr &= UARTBUF_LINE_ERRORS;
+
+    UB->LineStatus |= Lsr;
+
+    if (Lsr & UART_LineStatus_RxOverrun) {
+        UB->Stats.Overruns++;
+    }
+    if (Lsr & UART_LineStatus_ParityError) {
+        UB->Stats.ParityErrors++;
+    }
+    if (Lsr & UART_LineStatus_FramingError) {
+        UB->Stats.FramingErrors++;
+    }
+    if (Lsr & UART_LineStatus_Break) {
+        UB->Stats.Breaks++;
+    }
+}
+
+/** @brief  Update the Rx FIFO high-water mark
+  * @param  UB      Buffered UART state
+  * @param  Count   Bytes read before the FIFO first ran dry
+  * @return None.
+  *
+  * There's no FIFO level register, so the level is taken as the bytes read
+  *  before RxData first clears.  More than a FIFO's worth only means bytes
+  *  kept arriving during the drain; the FIFO itself can't hold more.
+  */
+static inline void UARTBuf_NoteRxFifoLevel(UARTBuf_Type *UB, uint16_t Count)
+{
+    if (Count > UART_RxFifoSize) {
+        Count = UART_RxFifoSize;
+    }
+
+    if (Count > UB->Stats.RxFifoHighWater) {
+        UB->Stats.RxFifoHighWater = Count;
+    }
+}
+
+/** @brief  Hand everything waiting in the Rx FIFO to the Rx sink
+  * @param  UB      Buffered UART state
+  * @return None.
+  */
+static inline void UARTBuf_DrainRxFifoToSink(UARTBuf_Type *UB)
+{
+    UART_Type *Uart = UB->Uart;
+    uint8_t Burst[UART_RxFifoSize];
+    uint16_t Count;
+    uint8_t First = 1;
+    uint8_t Lsr;
+
+
+    do {
+        Count = 0;
+        while ((Count < UART_RxFifoSize)
+            && ((Lsr = UART_GetLineStatus(Uart)) & UART_LineStatus_RxData))
+        {
+            if (Lsr & UARTBUF_LINE_ERRORS) {
+                UARTBuf_NoteLineErrors(UB, Lsr);
+            }
+            Burst[Count++] = UART_Recv(Uart);
+        }
+
+        if (Count) {
+            UB->RxSink(UB->RxSinkArg, Burst, Count);
+        }
+
+        /* Only the first burst says how full the FIFO was */
+        if (First) {
+            UARTBuf_NoteRxFifoLevel(UB, Count);
+            First = 0;
+        }
+    } while (Count == UART_RxFifoSize);
+}
+
+/** @brief  Move everything waiting in the Rx FIFO into the Rx ring
+  * @param  UB      Buffered UART state
+  * @return None.
+  */
+static inline void UARTBuf_DrainRxFifo(UARTBuf_Type *UB)
+{
+    UART_Type *Uart = UB->Uart;
+    uint16_t Head = UB->RxHead;
+    uint16_t Tail = UB->RxTail;
+    uint16_t Count = 0;
+    uint8_t Lsr;
+    uint8_t c;
+
+
+    if (UB->RxSink) {
+        UARTBuf_DrainRxFifoToSink(UB);
+        return;
+    }
+
+    while ((Lsr = UART_GetLineStatus(Uart)) & UART_LineStatus_RxData) {
+        if (Lsr & UARTBUF_LINE_ERRORS) {
+            UARTBuf_NoteLineErrors(UB, Lsr);
+        }
+
+        if (UB->RxHighWater && ((uint16_t)(Head - Tail) >= UB->RxHighWater)) {
+            /* Leave the rest in the FIFO; auto-RTS holds the sender off
+             *  once it fills to the trigger level.  UARTBuf_Read() turns
+             *  the Rx interrupt back on.
+             */
+            UART_DisableIT(Uart, UART_IT_RxData);
+            UB->RxThrottled = 1;
+            break;
+        }
+
+        c = UART_Recv(Uart);
+        Count++;
+
+        if ((uint16_t)(Head - Tail) > UB->RxMask) {
+            /* Ring full; the byte has to be read to clear it anyhow */
+            UB->RxDropped++;
+            continue;
+        }
+
+        UB->RxBuf[Head & UB->RxMask] = c;
+        Head++;
+    }
+
+    UB->RxHead = Head;
+
+    UARTBuf_NoteRxFifoLevel(UB, Count);
+    if ((uint16_t)(Head - Tail) > UB->Stats.RxRingHighWater) {
+        UB->Stats.RxRingHighWater = Head - Tail;
+    }
+}
+
+/** @brief  Load up to a full FIFO's worth of bytes for transmission
+  * @param  UB      Buffered UART state
+  * @return None.
+  *
+  * Must only be called when the Tx FIFO is known to be empty (THRE).
+  *  Ring data queued before a SendV goes first, then the SendV segments,
+  *  then anything queued in the ring since.  Turns the THRE interrupt off
+  *  once there's nothing left to send.
+  */
+static inline void UARTBuf_FillTxFifo(UARTBuf_Type *UB)
+{
+    UART_Type *Uart = UB->Uart;
+    uint16_t Tail = UB->TxTail;
+    uint8_t Room = UART_TxFifoSize;
+
+
+    while (Room) {
+        if ((UB->TxSeg != 0) && (Tail == UB->TxSegMark)) {
+            if (UB->TxSegLen == 0) {
+                /* Move on to the next segment, or finish up */
+                if (--UB->TxSegsLeft == 0) {
+                    UB->TxSeg = 0;
+                    if (UB->TxSegDone) {
+                        UB->TxSegDone(UB->TxSegDoneArg);
+                    }
+                } else {
+                    UB->TxSeg++;
+                    UB->TxSegData = UB->TxSeg->Data;
+                    UB->TxSegLen  = UB->TxSeg->Len;
+                }
+                continue;
+            }
+
+            UART_Send(Uart, *UB->TxSegData++);
+            UB->TxSegLen--;
+        } else if (Tail != UB->TxHead) {
+            UART_Send(Uart, UB->TxBuf[Tail & UB->TxMask]);
+            Tail++;
+        } else {
+            break;
+        }
+
+        Room--;
+    }
+
+    UB->TxTail = Tail;
+
+    if (Room == UART_TxFifoSize) {
+        UART_DisableIT(Uart, UART_IT_TxData);
+
+        if (UB->TxIdleHook) {
+            UB->TxIdleHook(UB->TxHookArg);
+        }
+    }
+}
+
+/** @brief  Make sure the transmitter is running
+  * @param  UB      Buffered UART state
+  * @return None.
+  *
+  * If the transmitter is idle, primes the FIFO; the THRE interrupt takes
+  *  over from there.  The UART's IRQ is held off while IER is being
+  *  modified since the ISR also turns THRE interrupts off.
+  */
+static inline void UARTBuf_StartTx(UARTBuf_Type *UB)
+{
+    VIC_DisableIRQ(UB->IRQn);
+
+    if (!(UART_GetEnabledIT(UB->Uart) & UART_IT_TxData)) {
+        if (UB->TxStartHook) {
+            UB->TxStartHook(UB->TxHookArg);
+        }
+
+        if (UART_GetLineStatus(UB->Uart) & UART_LineStatus_TxReady) {
+            UARTBuf_FillTxFifo(UB);
+        }
+
+        UART_EnableIT(UB->Uart, UART_IT_TxData);
+    }
+
+    VIC_EnableIRQ(UB->IRQn);
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Attach ring buffers to a UART and start interrupt-driven IO
+  *
+  * @param  [out] UB       Buffered UART state to initialize
+  * @param  [in]  Uart     The UART to service
+  * @param  [in]  IRQn     The UART's IRQ number (e.g. UART0_IRQn)
+  * @param  [in]  RxBuf    Receive ring storage
+  * @param  [in]  RxSize   Size of RxBuf (power of 2)
+  * @param  [in]  TxBuf    Transmit ring storage
+  * @param  [in]  TxSize   Size of TxBuf (power of 2)
+  * @param  [in]  Trigger  Rx FIFO level at which to interrupt
+  *
+  * @return None.
+  */
+void UARTBuf_Init(UARTBuf_Type *UB, UART_Type *Uart, IRQn_Type IRQn,
+                  uint8_t *RxBuf, uint16_t RxSize,
+                  uint8_t *TxBuf, uint16_t TxSize,
+                  UART_RxFifoTrigger_Type Trigger)
+{
+    lpc2xxx_lib_assert(UARTBUF_IS_RING_SIZE(RxSize));
+    lpc2xxx_lib_assert(UARTBUF_IS_RING_SIZE(TxSize));
+
+    VIC_DisableIRQ(IRQn);
+
+    UB->Uart        = Uart;
+    UB->IRQn        = IRQn;
+    UB->RxBuf       = RxBuf;
+    UB->RxMask      = RxSize - 1;
+    UB->RxHead      = 0;
+    UB->RxTail      = 0;
+    UB->RxSink      = 0;
+    UB->RxSinkArg   = 0;
+    UB->TxBuf       = TxBuf;
+    UB->TxMask      = TxSize - 1;
+    UB->TxHead      = 0;
+    UB->TxTail      = 0;
+    UB->TxSeg       = 0;
+    UB->TxStartHook = 0;
+    UB->TxIdleHook  = 0;
+    UB->TxHookArg   = 0;
+    UB->RxHighWater = 0;
+    UB->RxLowWater  = 0;
+    UB->RxThrottled = 0;
+    UB->LineStatus  = 0;
+    UB->RxDropped   = 0;
+
+    UB->Stats.Overruns        = 0;
+    UB->Stats.ParityErrors    = 0;
+    UB->Stats.FramingErrors   = 0;
+    UB->Stats.Breaks          = 0;
+    UB->Stats.RxRingHighWater = 0;
+    UB->Stats.RxFifoHighWater = 0;
+
+    UART_DisableIT(Uart, UART_IT_Mask);
+
+    /* Enables the FIFOs as well as setting the trigger level */
+    UART_SetRxFifoTrigger(Uart, Trigger);
+    UART_FlushRxFifo(Uart);
+    UART_FlushTxFifo(Uart);
+
+    /* Clear out any stale status */
+    UART_GetLineStatus(Uart);
+    UART_GetPendingITID(Uart);
+
+    UART_EnableIT(Uart, UART_IT_RxData | UART_IT_RxLineStatus);
+
+    VIC_EnableIRQ(IRQn);
+}
+
+
+/** @brief  Queue data for transmission
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [in]  Data     Bytes to send
+  * @param  [in]  Len      Number of bytes to send
+  *
+  * @return Number of bytes queued (less than Len if the Tx ring filled up).
+  */
+uint16_t UARTBuf_Write(UARTBuf_Type *UB, const uint8_t *Data, uint16_t Len)
+{
+    uint16_t Head = UB->TxHead;
+    uint16_t Free = UARTBuf_TxFree(UB);
+    uint16_t i;
+
+
+    if (Len > Free) {
+        Len = Free;
+    }
+
+    for (i = 0; i < Len; i++) {
+        UB->TxBuf[Head & UB->TxMask] = Data[i];
+        Head++;
+    }
+
+    UB->TxHead = Head;
+
+    if (Len == 0) {
+        return 0;
+    }
+
+    UARTBuf_StartTx(UB);
+
+    return Len;
+}
+
+
+/** @brief  Queue data for transmission, waiting for room as needed
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [in]  Data     Bytes to send
+  * @param  [in]  Len      Number of bytes to send
+  *
+  * @return None.
+  */
+void UARTBuf_WriteAll(UARTBuf_Type *UB, const uint8_t *Data, uint16_t Len)
+{
+    uint16_t Queued;
+
+
+    while (Len) {
+        Queued = UARTBuf_Write(UB, Data, Len);
+        Data += Queued;
+        Len  -= Queued;
+    }
+}
+
+
+/** @brief  Publish bytes written straight into the Tx ring
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [in]  Head     New Tx ring head (one past the last byte written)
+  *
+  * @return None.
+  */
+void UARTBuf_CommitTx(UARTBuf_Type *UB, uint16_t Head)
+{
+    if (Head == UB->TxHead) {
+        return;
+    }
+
+    UB->TxHead = Head;
+
+    UARTBuf_StartTx(UB);
+}
+
+
+/** @brief  Transmit a list of buffers without copying them
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [in]  Segs     Buffers to send, in order
+  * @param  [in]  Count    Number of entries in Segs (at least 1)
+  * @param  [in]  Done     Called (from the ISR) when finished; may be NULL
+  * @param  [in]  Arg      Passed to Done
+  *
+  * @return 1 if the transfer was started, 0 if one is already in progress.
+  */
+uint8_t UARTBuf_SendV(UARTBuf_Type *UB, const UARTBuf_Segment_Type *Segs,
+                      uint8_t Count, UARTBuf_Callback_Type Done, void *Arg)
+{
+    lpc2xxx_lib_assert(Count != 0);
+
+    VIC_DisableIRQ(UB->IRQn);
+
+    if (UB->TxSeg != 0) {
+        VIC_EnableIRQ(UB->IRQn);
+        return 0;
+    }
+
+    UB->TxSeg        = Segs;
+    UB->TxSegsLeft   = Count;
+    UB->TxSegData    = Segs[0].Data;
+    UB->TxSegLen     = Segs[0].Len;
+    UB->TxSegMark    = UB->TxHead;
+    UB->TxSegDone    = Done;
+    UB->TxSegDoneArg = Arg;
+
+    VIC_EnableIRQ(UB->IRQn);
+
+    UARTBuf_StartTx(UB);
+
+    return 1;
+}
+
+
+/** @brief  Retrieve received data
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [out] Data     Where to store received bytes
+  * @param  [in]  Len      Maximum number of bytes to retrieve
+  *
+  * @return Number of bytes retrieved (0 if none were waiting).
+  */
+uint16_t UARTBuf_Read(UARTBuf_Type *UB, uint8_t *Data, uint16_t Len)
+{
+    uint16_t Tail = UB->RxTail;
+    uint16_t Avail = UARTBuf_RxAvailable(UB);
+    uint16_t i;
+
+
+    if (Len > Avail) {
+        Len = Avail;
+    }
+
+    for (i = 0; i < Len; i++) {
+        Data[i] = UB->RxBuf[Tail & UB->RxMask];
+        Tail++;
+    }
+
+    UB->RxTail = Tail;
+
+    if (UB->RxThrottled && ((uint16_t)(UB->RxHead - Tail) <= UB->RxLowWater)) {
+        /* Let the ISR empty the FIFO again, which brings RTS back */
+        VIC_DisableIRQ(UB->IRQn);
+        UB->RxThrottled = 0;
+        UART_EnableIT(UB->Uart, UART_IT_RxData);
+        VIC_EnableIRQ(UB->IRQn);
+    }
+
+    return Len;
+}
+
+
+/** @brief  Turn on RTS / CTS flow control with Rx ring watermarks
+  *
+  * @param  [in]  UB        Buffered UART state (UART1 only)
+  * @param  [in]  HighWater Rx ring fill at which the sender is held off
+  * @param  [in]  LowWater  Rx ring fill at which it's let go again
+  *
+  * @return None.
+  */
+void UARTBuf_EnableFlowControl(UARTBuf_Type *UB, uint16_t HighWater, uint16_t LowWater)
+{
+    lpc2xxx_lib_assert(UB->Uart == UART1);
+    lpc2xxx_lib_assert((HighWater != 0) && (HighWater <= UB->RxMask + 1));
+    lpc2xxx_lib_assert(LowWater < HighWater);
+
+    VIC_DisableIRQ(UB->IRQn);
+
+    UB->RxHighWater = HighWater;
+    UB->RxLowWater  = LowWater;
+
+    UART_AutoRTSEnable(UB->Uart);
+    UART_AutoCTSEnable(UB->Uart);
+
+    VIC_EnableIRQ(UB->IRQn);
+}
+
+
+/** @brief  Turn off RTS / CTS flow control
+  *
+  * @param  [in]  UB       Buffered UART state
+  *
+  * @return None.
+  */
+void UARTBuf_DisableFlowControl(UARTBuf_Type *UB)
+{
+    VIC_DisableIRQ(UB->IRQn);
+
+    UART_AutoRTSDisable(UB->Uart);
+    UART_AutoCTSDisable(UB->Uart);
+
+    UB->RxHighWater = 0;
+
+    if (UB->RxThrottled) {
+        UB->RxThrottled = 0;
+        UART_EnableIT(UB->Uart, UART_IT_RxData);
+    }
+
+    VIC_EnableIRQ(UB->IRQn);
+}
+
+
+/** @brief  Service a UART interrupt
+  *
+  * @param  [in]  UB       Buffered UART state for the interrupting UART
+  *
+  * @return None.
+  */
+void UARTBuf_IRQHandler(UARTBuf_Type *UB)
+{
+    UART_Type *Uart = UB->Uart;
+    uint16_t Status;
+
+
+    while ((Status = UART_GetITStatus(Uart)) != UART_ITID_None) {
+#ifdef LPC2XXX_HAS_UART_AUTOBAUD
+        /* Not ours (see LPC2xxx_uart_autobaud.h), but left pending they
+         *  would keep the IRQ asserted forever.
+         */
+        if (Status & (UART_IT_AutoBaudEnd | UART_IT_AutoBaudTimeout)) {
+            UART_ClearAutoBaudIT(Uart, Status & (UART_IT_AutoBaudEnd
+                                                 | UART_IT_AutoBaudTimeout));
+            continue;
+        }
+#endif
+
+        switch (Status & UART_ITID_Mask) {
+            case UART_ITID_RxLineStatus:
+                /* Reading LSR clears the interrupt; keep the error bits */
+                UARTBuf_NoteLineErrors(UB, UART_GetLineStatus(Uart));
+                UARTBuf_DrainRxFifo(UB);
+                break;
+
+            case UART_ITID_RxDataAvailable:
+            case UART_ITID_CharacterTimeOut:
+                UARTBuf_DrainRxFifo(UB);
+                break;
+
+            case UART_ITID_TxEmpty:
+                /* Reading IIR cleared it; FIFO is empty, fill it back up */
+                UARTBuf_FillTxFifo(UB);
+                break;
+
+            case UART_ITID_ModemStatus:
+                UART_GetModemStatus(Uart);
+                break;
+
+            default:
+                return;
+        }
+    }
+}
@@ -0,0 +1,146 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart_dispatch.c
+ * @purpose: Shared, Table-Driven Buffered UART IRQ Handler for LPC2xxx CPUs
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+#include "LPC2xxx_vic.h"
+#include "LPC2xxx_uart_buffered.h"
+#include "LPC2xxx_uart_dispatch.h"
+#include "LPC2xxx_lib_assert.h"
+
+
+/* Variables ----------------------------------------------------------------*/
+
+/* Buffered UART for each port; NULL where nothing's attached */
+static UARTBuf_Type * volatile UARTDispatch_Ports[UARTDISPATCH_MAX_PORTS];
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Add a buffered UART to the dispatch table and route its IRQ
+  *
+  * @param  [in]  Port     Table index to use (e.g. 0 for UART0)
+  * @param  [in]  UB       Buffered UART state (already initialized)
+  * @param  [in]  Slot     VIC slot for the UART's IRQ, or
+  *                         UARTDISPATCH_SLOT_DEFAULT
+  *
+  * @return None.
+  */
+void UARTDispatch_Attach(uint8_t Port, UARTBuf_Type *UB, uint8_t Slot)
+{
+    lpc2xxx_lib_assert(Port < UARTDISPATCH_MAX_PORTS);
+    lpc2xxx_lib_assert(UB != 0);
+
+    UARTDispatch_Ports[Port] = UB;
+
+    if (Slot == UARTDISPATCH_SLOT_DEFAULT) {
+        VIC_SetDefaultIRQHandler(UARTDispatch_IRQHandler);
+    } else {
+        VIC_SetSlot(Slot, UB->IRQn, UARTDispatch_IRQHandler);
+        VIC_EnableSlot(Slot);
+    }
+}
+
+
+/** @brief  Remove a port from the dispatch table
+  *
+  * @param  [in]  Port     Table index
+  *
+  * @return None.
+  */
+void UARTDispatch_Detach(uint8_t Port)
+{
+    lpc2xxx_lib_assert(Port < UARTDISPATCH_MAX_PORTS);
+
+    UARTDispatch_Ports[Port] = 0;
+}
+
+
+/** @brief  Service all attached UARTs with a pending interrupt
+  *
+  * @return None.
+  */
+void UARTDispatch_IRQHandler(void) __attribute__ ((interrupt ("IRQ")));
+void UARTDispatch_IRQHandler(void)
+{
+    UARTBuf_Type *UB;
+    uint8_t i;
+
+
+    /* Check the VIC rather than each IIR: reading IIR has side effects,
+     *  and it's one register for all ports.
+     */
+    for (i = 0; i < UARTDISPATCH_MAX_PORTS; i++) {
+        UB = UARTDispatch_Ports[i];
+        if ((UB != 0) && VIC_GetPendingIRQ(UB->IRQn)) {
+            UARTBuf_IRQHandler(UB);
+        }
+    }
+
+    VIC_IRQDone();
+}
+
+
+/** @brief  Get a port's receive health counters
+  *
+  * @param  [in]  Port     Table index
+  * @param  [out] Stats    Where to put the counters
+  * @param  [in]  Clear    Non-zero to zero the counters afterwards
+  *
+  * @return 1 on success, 0 if nothing is attached at Port.
+  */
+uint8_t UARTDispatch_GetStats(uint8_t Port, UARTBuf_Stats_Type *Stats, uint8_t Clear)
+{
+    UARTBuf_Type *UB;
+
+
+    lpc2xxx_lib_assert(Port < UARTDISPATCH_MAX_PORTS);
+
+    UB = UARTDispatch_Ports[Port];
+    if (UB == 0) {
+        return 0;
+    }
+
+    UARTBuf_GetStats(UB, Stats, Clear);
+
+    return 1;
+}
+
@@ -0,0 +1,229 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart_framer.c
+ * @purpose: In-ISR COBS / SLIP Packet Framing of UART Data
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart_framer.h"
+#include "LPC2xxx_lib_assert.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief  Give up on the current frame because it's bad
+  * @param  F       Framer state
+  * @return None.
+  */
+static inline void UARTFramer_Bad(UARTFramer_Type *F)
+{
+    F->Errors++;
+    F->Discard = 1;
+}
+
+/** @brief  Store a decoded byte in the current frame
+  * @param  F       Framer state
+  * @param  b       The byte
+  * @return None.
+  */
+static inline void UARTFramer_Put(UARTFramer_Type *F, uint8_t b)
+{
+    if (F->Len == 0) {
+        /* Don't start a frame there's no room to keep */
+        if ((uint8_t)(F->Head - F->Tail) > F->SlotMask) {
+            F->Dropped++;
+            F->Discard = 1;
+            return;
+        }
+    } else if (F->Len >= F->PacketSize) {
+        UARTFramer_Bad(F);
+        return;
+    }
+
+    F->Pool[(F->Head & F->SlotMask) * F->SlotSize + 2 + F->Len] = b;
+    F->Len++;
+}
+
+/** @brief  Deliver the current frame (if any) and get ready for the next
+  * @param  F       Framer state
+  * @return None.
+  */
+static inline void UARTFramer_EndFrame(UARTFramer_Type *F)
+{
+    uint8_t *Slot;
+
+
+    if (!F->Discard && (F->Len != 0)) {
+        Slot = F->Pool + (F->Head & F->SlotMask) * F->SlotSize;
+        Slot[0] = F->Len & 0xff;
+        Slot[1] = F->Len >> 8;
+        F->Head++;
+        F->Frames++;
+    }
+
+    F->Len     = 0;
+    F->Escape  = 0;
+    F->Left    = 0;
+    F->Zero    = 0;
+    F->Discard = 0;
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Set up a packet framer
+  *
+  * @param  [out] F           Framer state to initialize
+  * @param  [in]  Mode        Framing to decode
+  * @param  [in]  Pool        Packet storage, UARTFRAMER_POOL_SIZE() bytes
+  * @param  [in]  NumPackets  Number of packet slots (power of 2, <= 128)
+  * @param  [in]  PacketSize  Largest decoded packet to accept
+  *
+  * @return None.
+  */
+void UARTFramer_Init(UARTFramer_Type *F, UARTFramer_Mode_Type Mode,
+                     uint8_t *Pool, uint8_t NumPackets, uint16_t PacketSize)
+{
+    lpc2xxx_lib_assert(UARTFRAMER_IS_MODE(Mode));
+    lpc2xxx_lib_assert(UARTFRAMER_IS_PACKET_COUNT(NumPackets));
+    lpc2xxx_lib_assert(PacketSize != 0);
+
+    F->Pool       = Pool;
+    F->SlotSize   = PacketSize + 2;
+    F->PacketSize = PacketSize;
+    F->SlotMask   = NumPackets - 1;
+    F->Head       = 0;
+    F->Tail       = 0;
+    F->Mode       = Mode;
+    F->Frames     = 0;
+    F->Dropped    = 0;
+    F->Errors     = 0;
+
+    /* Whatever arrives before the first delimiter is a partial frame */
+    UARTFramer_EndFrame(F);
+    F->Discard    = 1;
+}
+
+
+/** @brief  Decode received bytes
+  *
+  * @param  [in]  F        Framer state
+  * @param  [in]  Data     Received (encoded) bytes
+  * @param  [in]  Len      Number of bytes
+  *
+  * @return None.
+  */
+void UARTFramer_Feed(UARTFramer_Type *F, const uint8_t *Data, uint16_t Len)
+{
+    uint8_t b;
+
+
+    if (F->Mode == UARTFramer_Mode_SLIP) {
+        while (Len--) {
+            b = *Data++;
+
+            if (b == UARTFRAMER_SLIP_END) {
+                UARTFramer_EndFrame(F);
+            } else if (F->Discard) {
+                continue;
+            } else if (F->Escape) {
+                F->Escape = 0;
+                if (b == UARTFRAMER_SLIP_ESC_END) {
+                    UARTFramer_Put(F, UARTFRAMER_SLIP_END);
+                } else if (b == UARTFRAMER_SLIP_ESC_ESC) {
+                    UARTFramer_Put(F, UARTFRAMER_SLIP_ESC);
+                } else {
+                    UARTFramer_Bad(F);
+                }
+            } else if (b == UARTFRAMER_SLIP_ESC) {
+                F->Escape = 1;
+            } else {
+                UARTFramer_Put(F, b);
+            }
+        }
+    } else {
+        while (Len--) {
+            b = *Data++;
+
+            if (b == UARTFRAMER_COBS_END) {
+                /* Delimiter in the middle of a block => truncated frame */
+                if (!F->Discard && (F->Left != 0)) {
+                    UARTFramer_Bad(F);
+                }
+                UARTFramer_EndFrame(F);
+            } else if (F->Discard) {
+                continue;
+            } else if (F->Left == 0) {
+                /* Code byte: the zero implied by the previous block (if
+                 *  any) is only real if another block follows it.
+                 */
+                if (F->Zero) {
+                    UARTFramer_Put(F, 0);
+                }
+                F->Zero = (b != 0xff);
+                F->Left = b - 1;
+            } else {
+                UARTFramer_Put(F, b);
+                F->Left--;
+            }
+        }
+    }
+}
+
+
+/** @brief  UARTFramer_Feed() in the form of a UARTBuf_RxSink_Type
+  *
+  * @param  [in]  Arg      The UARTFramer_Type to feed
+  * @param  [in]  Data     Received (encoded) bytes
+  * @param  [in]  Len      Number of bytes
+  *
+  * @return None.
+  */
+void UARTFramer_RxSink(void *Arg, const uint8_t *Data, uint16_t Len)
+{
+    UARTFramer_Feed((UARTFramer_Type *)Arg, Data, Len);
+}
+
@@ -0,0 +1,373 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart_printf.c
+ * @purpose: Compact Formatted Output to a Buffered UART for LPC2xxx CPUs
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdarg.h>
+
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart_buffered.h"
+#include "LPC2xxx_uart_printf.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/* Conversion flags */
+#define UARTPRINTF_LEFT   (1 << 0)   /* '-': pad on the right                */
+#define UARTPRINTF_ZERO   (1 << 1)   /* '0': pad numbers with zeros          */
+#define UARTPRINTF_UPPER  (1 << 2)   /* Upper case hex digits                */
+#define UARTPRINTF_HEX    (1 << 3)   /* Base 16 rather than 10               */
+#define UARTPRINTF_PREC   (1 << 4)   /* A precision was given ('.0' counts)  */
+
+/* Output state while formatting */
+typedef struct {
+    UARTBuf_Type  *UB;               /* Where it's going                     */
+    uint16_t       Head;             /* Next Tx ring slot (not yet published)*/
+    int            Count;            /* Characters written so far            */
+} UARTPrintf_Out_Type;
+
+
+/** @brief  Put one character in the Tx ring, waiting for room if needed
+  * @param  Out     Output state
+  * @param  c       Character to put
+  * @return None.
+  */
+static inline void UARTPrintf_Put(UARTPrintf_Out_Type *Out, char c)
+{
+    UARTBuf_Type *UB = Out->UB;
+
+
+    if ((uint16_t)(Out->Head - UB->TxTail) > UB->TxMask) {
+        /* Full: hand over what's there and wait for the ISR to make room */
+        UARTBuf_CommitTx(UB, Out->Head);
+        while ((uint16_t)(Out->Head - UB->TxTail) > UB->TxMask);
+    }
+
+    UB->TxBuf[Out->Head & UB->TxMask] = c;
+    Out->Head++;
+    Out->Count++;
+}
+
+#if UARTPRINTF_WIDTH
+/** @brief  Put a number of copies of a character
+  * @param  Out     Output state
+  * @param  c       Character to put
+  * @param  Count   How many (may be <= 0)
+  * @return None.
+  */
+static void UARTPrintf_Pad(UARTPrintf_Out_Type *Out, char c, int Count)
+{
+    while (Count-- > 0) {
+        UARTPrintf_Put(Out, c);
+    }
+}
+#endif
+
+/** @brief  Divide by 10 without a library call
+  * @param  n       Dividend
+  * @return n / 10
+  *
+  * ARM7 has no divide instruction, but UMULL makes this cheap; exact for
+  *  all 32 bit values.
+  */
+static inline uint32_t UARTPrintf_Div10(uint32_t n)
+{
+    return (uint32_t)(((uint64_t)n * 0xcccccccdUL) >> 35);
+}
+
+/** @brief  Render a number
+  * @param  Out     Output state
+  * @param  Value   Magnitude to print
+  * @param  Sign    '-' (or 0 for none)
+  * @param  Point   Digits after the decimal point (0 for an integer)
+  * @param  Flags   UARTPRINTF_* flags
+  * @param  Width   Minimum field width
+  * @return None.
+  */
+static void UARTPrintf_Number(UARTPrintf_Out_Type *Out, uint32_t Value, char Sign,
+                              uint8_t Point, uint8_t Flags, int Width)
+{
+    /* Digits are generated least significant first */
+    char Digits[12];
+    char Alpha = (Flags & UARTPRINTF_UPPER) ? 'A' - 10 : 'a' - 10;
+    uint8_t Len = 0;
+    uint8_t Count = 0;
+    uint32_t q;
+    uint8_t d;
+
+
+    do {
+        if (Flags & UARTPRINTF_HEX) {
+            d = Value & 0x0f;
+            Value >>= 4;
+        } else {
+            q = UARTPrintf_Div10(Value);
+            d = Value - q * 10;
+            Value = q;
+        }
+
+        Digits[Len++] = d + ((d < 10) ? '0' : Alpha);
+
+        if (++Count == Point) {
+            Digits[Len++] = '.';
+        }
+    } while (Value || (Count <= Point));
+
+#if UARTPRINTF_WIDTH
+    Width -= Len + (Sign ? 1 : 0);
+
+    if (!(Flags & (UARTPRINTF_LEFT | UARTPRINTF_ZERO))) {
+        UARTPrintf_Pad(Out, ' ', Width);
+    }
+#else
+    (void)Width;
+#endif
+
+    if (Sign) {
+        UARTPrintf_Put(Out, Sign);
+    }
+
+#if UARTPRINTF_WIDTH
+    if ((Flags & (UARTPRINTF_LEFT | UARTPRINTF_ZERO)) == UARTPRINTF_ZERO) {
+        UARTPrintf_Pad(Out, '0', Width);
+    }
+#endif
+
+    while (Len) {
+        UARTPrintf_Put(Out, Digits[--Len]);
+    }
+
+#if UARTPRINTF_WIDTH
+    if (Flags & UARTPRINTF_LEFT) {
+        UARTPrintf_Pad(Out, ' ', Width);
+    }
+#endif
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Format text into a buffered UART's Tx ring
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [in]  Fmt      printf-style format
+  * @param  [in]  Args     Arguments for the format
+  *
+  * @return Number of characters written.
+  */
+int UARTBuf_VPrintf(UARTBuf_Type *UB, const char *Fmt, va_list Args)
+{
+    UARTPrintf_Out_Type Out;
+    const char *s;
+    uint8_t Flags;
+    uint8_t Prec;
+    int Width;
+    int32_t v;
+    char c;
+
+
+    Out.UB    = UB;
+    Out.Head  = UB->TxHead;
+    Out.Count = 0;
+
+    while ((c = *Fmt++) != '\0') {
+        if (c != '%') {
+            UARTPrintf_Put(&Out, c);
+            continue;
+        }
+
+        Flags = 0;
+        Width = 0;
+        Prec  = 0;
+
+        /* Flags and width are always parsed (so a '*' always takes its
+         *  argument); they're just ignored if widths aren't compiled in
+         */
+        for (;;) {
+            if (*Fmt == '-') {
+                Flags |= UARTPRINTF_LEFT;
+            } else if (*Fmt == '0') {
+                Flags |= UARTPRINTF_ZERO;
+            } else {
+                break;
+            }
+            Fmt++;
+        }
+
+        if (*Fmt == '*') {
+            Width = va_arg(Args, int);
+            if (Width < 0) {
+                Flags |= UARTPRINTF_LEFT;
+                Width = -Width;
+            }
+            Fmt++;
+        } else {
+            while ((*Fmt >= '0') && (*Fmt <= '9')) {
+                Width = Width * 10 + (*Fmt++ - '0');
+            }
+        }
+
+        /* Precision: digits after the point for %q (and, with widths
+         *  compiled in, the most characters of a %s to print)
+         */
+        if (*Fmt == '.') {
+            Flags |= UARTPRINTF_PREC;
+            Fmt++;
+            while ((*Fmt >= '0') && (*Fmt <= '9')) {
+                /* Saturate rather than wrap; anything over 9 is clamped */
+                Prec = (Prec < 25) ? (Prec * 10 + (*Fmt - '0')) : 255;
+                Fmt++;
+            }
+        }
+
+        while ((*Fmt == 'l') || (*Fmt == 'h')) {
+            Fmt++;
+        }
+
+        switch (c = *Fmt++) {
+            case 'd':
+            case 'i':
+            case 'q':
+                v = va_arg(Args, int32_t);
+                if (c != 'q') {
+                    Prec = 0;
+                } else if (Prec > 9) {
+                    Prec = 9;
+                }
+                UARTPrintf_Number(&Out, (v < 0) ? -(uint32_t)v : (uint32_t)v,
+                                  (v < 0) ? '-' : 0, Prec, Flags, Width);
+                break;
+
+            case 'u':
+                UARTPrintf_Number(&Out, va_arg(Args, uint32_t), 0, 0, Flags, Width);
+                break;
+
+            case 'X':
+                Flags |= UARTPRINTF_UPPER;
+                /* Fall through */
+            case 'x':
+                UARTPrintf_Number(&Out, va_arg(Args, uint32_t), 0, 0,
+                                  Flags | UARTPRINTF_HEX, Width);
+                break;
+
+            case 'c':
+                UARTPrintf_Put(&Out, (char)va_arg(Args, int));
+                break;
+
+            case 's':
+                s = va_arg(Args, const char *);
+                if (s == 0) {
+                    s = "(null)";
+                }
+#if UARTPRINTF_WIDTH
+                {
+                    const char *e = s;
+                    int Len;
+
+
+                    while (*e && (!(Flags & UARTPRINTF_PREC) || ((e - s) < Prec))) {
+                        e++;
+                    }
+                    Len = e - s;
+
+                    if (!(Flags & UARTPRINTF_LEFT)) {
+                        UARTPrintf_Pad(&Out, ' ', Width - Len);
+                    }
+                    while (s != e) {
+                        UARTPrintf_Put(&Out, *s++);
+                    }
+                    if (Flags & UARTPRINTF_LEFT) {
+                        UARTPrintf_Pad(&Out, ' ', Width - Len);
+                    }
+                }
+#else
+                while (*s) {
+                    UARTPrintf_Put(&Out, *s++);
+                }
+#endif
+                break;
+
+            case '\0':
+                /* Stray '%' at the end of the format */
+                Fmt--;
+                break;
+
+            default:
+                /* "%%", or something unsupported: print it as is */
+                if (c != '%') {
+                    UARTPrintf_Put(&Out, '%');
+                }
+                UARTPrintf_Put(&Out, c);
+                break;
+        }
+    }
+
+    UARTBuf_CommitTx(UB, Out.Head);
+
+    return Out.Count;
+}
+
+
+/** @brief  Format text into a buffered UART's Tx ring
+  *
+  * @param  [in]  UB       Buffered UART state
+  * @param  [in]  Fmt      printf-style format
+  *
+  * @return Number of characters written.
+  */
+int UARTBuf_Printf(UARTBuf_Type *UB, const char *Fmt, ...)
+{
+    va_list Args;
+    int Count;
+
+
+    va_start(Args, Fmt);
+    Count = UARTBuf_VPrintf(UB, Fmt, Args);
+    va_end(Args);
+
+    return Count;
+}
+
@@ -0,0 +1,244 @@
+/******************************************************************************
+ * @file:    LPC2xxx_uart_rs485.c
+ * @purpose: RS-485 Half-Duplex Driver Enable Control for LPC2xxx CPUs
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+/* Needs an old-style 32-bit TIMER for the turnaround */
+#if defined(LPC2XXX_HAS_TIMER) && defined(LPC2XXX_HAS_GPIO)
+
+#include "LPC2xxx_uart.h"
+#include "LPC2xxx_timer.h"
+#include "LPC2xxx_gpio.h"
+#include "LPC2xxx_vic.h"
+#include "LPC2xxx_uart_rs485.h"
+#include "LPC2xxx_syscon.h"
+#include "LPC2xxx_lib_assert.h"
+#include "system_LPC2xxx.h"
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief  (Re)start the turnaround timer
+  * @param  RS      RS-485 state
+  * @param  Ticks   PCLKs until the match
+  * @return None.
+  */
+static inline void UARTRS485_StartTimer(UARTRS485_Type *RS, uint32_t Ticks)
+{
+    TIMER_Disable(RS->Timer);
+    TIMER_SetCount(RS->Timer, 0);
+    TIMER_SetPrescalerCount(RS->Timer, 0);
+    TIMER_SetChannelMatchValue(RS->Timer, 0, Ticks);
+    TIMER_Enable(RS->Timer);
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Set up RS-485 direction control, starting out receiving
+  *
+  * @param  [out] RS        RS-485 state to initialize
+  * @param  [in]  Uart      UART driving the transceiver (line settings done)
+  * @param  [in]  Timer     Timer to use for the turnaround (MR0)
+  * @param  [in]  TimerIRQn The timer's IRQ number (e.g. TIM1_IRQn)
+  * @param  [in]  GPIO      Port with the DE pin
+  * @param  [in]  DEPin     DE pin (GPIO_Pin_x, active high)
+  * @param  [in]  Baud      The UART's baud rate
+  *
+  * @return None.
+  */
+void UARTRS485_Init(UARTRS485_Type *RS, UART_Type *Uart,
+                    TIMER_Type *Timer, IRQn_Type TimerIRQn,
+                    GPIO_Type *GPIO, uint32_t DEPin, uint32_t Baud)
+{
+    uint32_t PClk = SystemCoreClock / SYSCON_GetAPBClockDivider();
+    uint8_t Bits;
+
+
+    lpc2xxx_lib_assert(Baud != 0);
+    lpc2xxx_lib_assert(DEPin != 0);
+
+    VIC_DisableIRQ(TimerIRQn);
+
+    /* Start bit, data bits, parity, stop bit(s) */
+    Bits = 1 + 5 + UART_GetWordLength(Uart) + 1;
+    if (UART_GetParity(Uart) != UART_Parity_No) {
+        Bits++;
+    }
+    if (UART_GetStopBits(Uart) == UART_StopBits_2) {
+        Bits++;
+    }
+
+    RS->Uart        = Uart;
+    RS->Timer       = Timer;
+    RS->TimerIRQn   = TimerIRQn;
+    RS->GPIO        = GPIO;
+    RS->DEPin       = DEPin;
+    RS->BitTicks    = (PClk + Baud / 2) / Baud;
+    RS->IdleTicks   = RS->BitTicks * (Bits + 1);
+    RS->RxIT        = 0;
+    RS->State       = UARTRS485_State_Rx;
+    RS->Turnarounds = 0;
+    RS->Late        = 0;
+
+    GPIO_ClearPins(GPIO, DEPin);
+    GPIO_SetPinDirections(GPIO, DEPin, GPIO_Direction_Out);
+
+    /* One-shot: interrupt, reset and stop on MR0 */
+    TIMER_Disable(Timer);
+    TIMER_SetMode(Timer, TIMER_Mode_Timer);
+    TIMER_SetPrescaler(Timer, 0);
+    TIMER_SetChannelMatchControl(Timer, 0, TIMER_MatchControl_Interrupt
+                                           | TIMER_MatchControl_Reset
+                                           | TIMER_MatchControl_Stop);
+    TIMER_SetCount(Timer, 0);
+    TIMER_ClearPendingIT(Timer, TIMER_IT_MR0);
+
+    VIC_EnableIRQ(TimerIRQn);
+}
+
+
+/** @brief  Take the bus before transmitting
+  *
+  * @param  [in]  Arg      The UARTRS485_Type
+  *
+  * @return None.
+  */
+void UARTRS485_TxStart(void *Arg)
+{
+    UARTRS485_Type *RS = Arg;
+
+
+    /* The timer ISR also touches IER; keep it out until the timer's
+     *  stopped (after which it can't fire).
+     */
+    VIC_DisableIRQ(RS->TimerIRQn);
+
+    TIMER_Disable(RS->Timer);
+    TIMER_ClearPendingIT(RS->Timer, TIMER_IT_MR0);
+
+    if (RS->State == UARTRS485_State_Rx) {
+        RS->RxIT = UART_GetEnabledIT(RS->Uart)
+                   & (UART_IT_RxData | UART_IT_RxLineStatus);
+        UART_DisableIT(RS->Uart, RS->RxIT);
+
+        GPIO_SetPins(RS->GPIO, RS->DEPin);
+    }
+
+    /* A turnaround in progress is simply called off; DE stays up */
+    RS->State = UARTRS485_State_Tx;
+
+    VIC_EnableIRQ(RS->TimerIRQn);
+}
+
+
+/** @brief  Schedule releasing the bus after the last byte
+  *
+  * @param  [in]  Arg      The UARTRS485_Type
+  *
+  * @return None.
+  */
+void UARTRS485_TxIdle(void *Arg)
+{
+    UARTRS485_Type *RS = Arg;
+
+
+    if (RS->State == UARTRS485_State_Rx) {
+        return;
+    }
+
+    /* The last byte has just moved into the shift register: it's out a
+     *  character time from now, and DE drops a bit time after that.
+     */
+    RS->State = UARTRS485_State_Turnaround;
+    UARTRS485_StartTimer(RS, RS->IdleTicks);
+}
+
+
+/** @brief  Service the turnaround timer's interrupt
+  *
+  * @param  [in]  RS       RS-485 state
+  *
+  * @return None.
+  */
+void UARTRS485_TimerIRQHandler(UARTRS485_Type *RS)
+{
+    UART_Type *Uart = RS->Uart;
+
+
+    TIMER_ClearPendingIT(RS->Timer, TIMER_IT_MR0);
+
+    if (RS->State != UARTRS485_State_Turnaround) {
+        return;
+    }
+
+    /* THRE was serviced late enough that the byte isn't out yet; give it
+     *  another bit time.
+     */
+    if (!(UART_GetLineStatus(Uart) & UART_LineStatus_TxEmpty)) {
+        RS->Late++;
+        UARTRS485_StartTimer(RS, RS->BitTicks);
+        return;
+    }
+
+    GPIO_ClearPins(RS->GPIO, RS->DEPin);
+
+    /* Throw out whatever came in while we were driving the bus */
+    while (UART_GetLineStatus(Uart) & UART_LineStatus_RxData) {
+        UART_Recv(Uart);
+    }
+
+    RS->State = UARTRS485_State_Rx;
+    RS->Turnarounds++;
+
+    UART_EnableIT(Uart, RS->RxIT);
+}
+
+#endif /* #if defined(LPC2XXX_HAS_TIMER) && defined(LPC2XXX_HAS_GPIO) */
+
@@ -0,0 +1,220 @@
+/******************************************************************************
+ * @file:    LPC2xxx_ws2812.c
+ * @purpose: Driving WS2812 / SK6812 LED Strips From an SSP
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include "LPC2xxx.h"
+
+#ifdef LPC2XXX_HAS_SSP
+
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_syscon.h"
+#include "LPC2xxx_ws2812.h"
+#include "LPC2xxx_lib_assert.h"
+#include "system_LPC2xxx.h"
+
+/* Nothing to build if the APB clock can't make the strip's timing */
+#ifdef WS2812_AVAILABLE
+
+
+/* Variables ----------------------------------------------------------------*/
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+#define WS2812_BIT(Nibble, Bit) (((Nibble) & (1 << (Bit))) ? WS2812_ONE : WS2812_ZERO)
+#define WS2812_NIBBLE(Nibble)   ((WS2812_BIT(Nibble, 3) << (3 * WS2812_SSP_BITS)) \
+                               | (WS2812_BIT(Nibble, 2) << (2 * WS2812_SSP_BITS)) \
+                               | (WS2812_BIT(Nibble, 1) << (1 * WS2812_SSP_BITS)) \
+                               | (WS2812_BIT(Nibble, 0)))
+
+/* SSP frame for each nibble of pixel data, MSB first */
+static const uint16_t WS2812_Pattern[16] = {
+    WS2812_NIBBLE(0x0), WS2812_NIBBLE(0x1), WS2812_NIBBLE(0x2), WS2812_NIBBLE(0x3),
+    WS2812_NIBBLE(0x4), WS2812_NIBBLE(0x5), WS2812_NIBBLE(0x6), WS2812_NIBBLE(0x7),
+    WS2812_NIBBLE(0x8), WS2812_NIBBLE(0x9), WS2812_NIBBLE(0xa), WS2812_NIBBLE(0xb),
+    WS2812_NIBBLE(0xc), WS2812_NIBBLE(0xd), WS2812_NIBBLE(0xe), WS2812_NIBBLE(0xf),
+};
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* File Local Functions -----------------------------------------------------*/
+
+/* Keep Doxygen from documenting file static functions
+ *  (while still picking up static inlines in headers)
+ */
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/** @brief  Fill the Tx FIFO with the next frames of the refresh
+  * @param  W       Strip state
+  * @return 1 if there's more to come, 0 once the latch gap is all queued
+  */
+static inline uint8_t WS2812_Fill(WS2812_Type *W)
+{
+    SSP_Type *SSP = W->SSP;
+    uint8_t Byte;
+
+
+    while (SSP_TxIsReady(SSP)) {
+        if (W->LowPending) {
+            SSP_Send(SSP, WS2812_Pattern[W->Low]);
+            W->LowPending = 0;
+        } else if (W->Left) {
+            Byte = *W->Data++;
+            W->Left--;
+            SSP_Send(SSP, WS2812_Pattern[Byte >> 4]);
+            W->Low = Byte & 0x0f;
+            W->LowPending = 1;
+        } else if (W->Reset) {
+            SSP_Send(SSP, 0);
+            W->Reset--;
+        } else {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+#endif /* #ifndef DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/** @brief  Set up an SSP to drive an LED strip
+  *
+  * @param  [out] W        Strip state to initialize
+  * @param  [in]  SSP      The SSP to use
+  *
+  * @return None.
+  */
+void WS2812_Init(WS2812_Type *W, SSP_Type *SSP)
+{
+    lpc2xxx_lib_assert(SystemCoreClock / SYSCON_GetAPBClockDivider() == WS2812_PCLK);
+
+    W->SSP        = SSP;
+    W->Left       = 0;
+    W->Reset      = 0;
+    W->LowPending = 0;
+    W->Done       = 0;
+    W->Busy       = 0;
+
+    /* With phase B, back to back frames run without a gap, so MOSI is a
+     *  continuous bit stream.
+     */
+    SSP_Disable(SSP);
+    SSP_DisableIT(SSP, SSP_IT_RxOverrun | SSP_IT_RxTimer
+                       | SSP_IT_RxHalfFull | SSP_IT_TxHalfEmpty);
+    SSP_SetMode(SSP, SSP_Mode_Master);
+    SSP_SetWordSize(SSP, WS2812_FRAME_BITS);
+    SSP_SetFrameFormat(SSP, SSP_FrameFormat_SPI);
+    SSP_SetClockPolarity(SSP, SSP_ClockPolarity_Low);
+    SSP_SetClockPhase(SSP, SSP_ClockPhase_B);
+    SSP_SetClockPrescaler(SSP, WS2812_PRESCALER);
+    SSP_SetClockRate(SSP, WS2812_RATE);
+    SSP_Enable(SSP);
+}
+
+
+/** @brief  Start sending pixel data to the strip
+  *
+  * @param  [in]  W        Strip state
+  * @param  [in]  Pixels   Pixel bytes, in wire order
+  * @param  [in]  Len      Number of bytes (3 or 4 per LED)
+  * @param  [in]  Done     Called (from the ISR) once the latch gap has been
+  *                         queued
+  * @param  [in]  Arg      Passed to Done
+  *
+  * @return 1 if started, 0 if a refresh is already running.
+  */
+uint8_t WS2812_Show(WS2812_Type *W, const uint8_t *Pixels, uint32_t Len,
+                    WS2812_Callback_Type Done, void *Arg)
+{
+    if (W->Busy) {
+        return 0;
+    }
+
+    W->Data       = Pixels;
+    W->Left       = Len;
+    W->Reset      = WS2812_RESET_FRAMES;
+    W->LowPending = 0;
+    W->Done       = Done;
+    W->Arg        = Arg;
+    W->Busy       = 1;
+
+    /* Nothing comes back that's wanted; don't let stale frames pile up */
+    while (SSP_RxIsAvailable(W->SSP)) {
+        SSP_Recv(W->SSP);
+    }
+
+    WS2812_Fill(W);
+    SSP_EnableIT(W->SSP, SSP_IT_TxHalfEmpty);
+
+    return 1;
+}
+
+
+/** @brief  Service the SSP's interrupt
+  *
+  * @param  [in]  W        Strip state
+  *
+  * @return None.
+  */
+void WS2812_IRQHandler(WS2812_Type *W)
+{
+    if (W->Busy && WS2812_Fill(W)) {
+        return;
+    }
+
+    SSP_DisableIT(W->SSP, SSP_IT_TxHalfEmpty);
+
+    if (W->Busy) {
+        W->Busy = 0;
+
+        if (W->Done) {
+            W->Done(W->Arg);
+        }
+    }
+}
+
+#endif /* #ifdef WS2812_AVAILABLE */
+
+#endif /* #ifdef LPC2XXX_HAS_SSP */
+
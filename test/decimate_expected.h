@@ -0,0 +1,318 @@
+/* decimate_expected.h : outputs decimate_golden.c checks against.
+ *
+ * Generated by "make -C test regen-decimate"; don't edit by hand.
+ */
+
+static const int32_t Expected_CaseCIC3x16[64] = {
+    -207396864, -796499968, -685979648, -411146240, -158047232, 123098112,
+    415624192, 678524928, 949367808, 913845248, 674817024, 401065984,
+    120180736, -117352448, -399323136, -664934400, -922144768, -913074176,
+    -625096704, -389650432, -132029440, 168973312, 425454592, 689076224,
+    944059392, 920136704, 671474688, 382781440, 108253184, -140617728,
+    -408563712, -690100224, -916180992, -927033344, -669595648, -387684352,
+    -112499712, 137450496, 406383616, 682326016, 908866560, 903228416,
+    638772224, 370853888, 117100544, -144877568, -396505088, -664541184,
+    -906809344, -901408768, -658257920, -400136192, -120036352, 128930816,
+    406907904, 684226560, 920597504, 912665600, 658498560, 375179264,
+    126472192, -142387200, -420622336, -683677696,
+};
+
+static const int32_t Expected_CaseCIC4x10[102] = {
+    -46667520, -375047424, -542459648, -455598336, -350019584, -244194048,
+    -149980416, -53168640, 57092864, 174110976, 282376448, 371267328,
+    489157120, 598483456, 608569600, 517389056, 428941312, 326903808,
+    218075648, 105211392, 11568384, -71074048, -183546112, -293668608,
+    -389316608, -493482496, -594766336, -597806336, -493949952, -370673152,
+    -280173312, -204169728, -100329984, 20224256, 132878336, 226214656,
+    320968704, 425446400, 532265472, 618104576, 584299776, 479057920,
+    390202112, 271704576, 160757504, 57220352, -26004992, -134331904,
+    -231906048, -340985856, -449251584, -537693184, -602308096, -577267712,
+    -463283200, -363729152, -255373568, -137182976, -46864896, 47410432,
+    150361856, 250392064, 366058496, 457641216, 550175232, 601697792,
+    538170880, 425984512, 321583360, 220370176, 124984064, 28006912,
+    -75772928, -168643328, -266326272, -369319936, -472144384, -565281280,
+    -599923200, -511813888, -414704640, -324706048, -217949696, -104890112,
+    -11485440, 83016960, 182322688, 303304960, 403267840, 499870464,
+    591239936, 587968512, 507813632, 397466112, 280386816, 187172864,
+    91423488, -5327872, -115095296, -219479808, -325612544, -421545984,
+};
+
+static const int32_t Expected_CaseFIRQ15[1024] = {
+    241, 556, 554, -490, -3118, -7328,
+    -12519, -17991, -23024, -26942, -29220, -29864,
+    -29415, -28577, -27782, -27208, -26621, -26020,
+    -25406, -24821, -24336, -23983, -23679, -23347,
+    -22952, -22487, -21972, -21388, -20750, -20098,
+    -19495, -18951, -18445, -17942, -17458, -17000,
+    -16586, -16221, -15869, -15493, -15057, -14573,
+    -14088, -13617, -13176, -12780, -12433, -12093,
+    -11706, -11235, -10668, -10050, -9419, -8803,
+    -8230, -7733, -7296, -6902, -6536, -6175,
+    -5824, -5469, -5090, -4672, -4198, -3690,
+    -3136, -2540, -1911, -1250, -576, 64,
+    666, 1183, 1616, 2008, 2386, 2790,
+    3236, 3724, 4251, 4820, 5415, 6017,
+    6589, 7134, 7657, 8166, 8639, 9074,
+    9498, 9960, 10444, 10898, 11271, 11596,
+    11920, 12310, 12764, 13266, 13814, 14402,
+    14970, 15494, 15944, 16371, 16837, 17353,
+    17922, 18489, 19024, 19529, 19991, 20399,
+    20793, 21180, 21586, 22025, 22513, 23078,
+    23713, 24376, 25042, 25662, 26245, 26789,
+    27282, 27707, 28068, 28404, 28752, 29126,
+    29510, 29876, 30212, 30501, 30665, 30613,
+    30334, 29889, 29370, 28822, 28251, 27667,
+    27066, 26476, 25860, 25200, 24535, 23908,
+    23341, 22837, 22383, 21968, 21618, 21321,
+    21029, 20709, 20332, 19893, 19368, 18768,
+    18127, 17472, 16841, 16254, 15727, 15279,
+    14917, 14586, 14240, 13892, 13527, 13152,
+    12706, 12188, 11631, 11064, 10524, 9984,
+    9438, 8896, 8387, 7924, 7522, 7156,
+    6793, 6391, 5896, 5300, 4591, 3803,
+    3015, 2298, 1737, 1315, 975, 653,
+    318, -24, -387, -779, -1215, -1693,
+    -2221, -2788, -3402, -4024, -4616, -5174,
+    -5691, -6168, -6607, -7007, -7383, -7754,
+    -8143, -8560, -9020, -9556, -10155, -10776,
+    -11355, -11856, -12275, -12651, -13006, -13377,
+    -13803, -14353, -15011, -15707, -16358, -16920,
+    -17393, -17798, -18106, -18374, -18694, -19128,
+    -19682, -20270, -20853, -21446, -22048, -22643,
+    -23210, -23721, -24203, -24677, -25152, -25626,
+    -26092, -26548, -27004, -27460, -27904, -28325,
+    -28728, -29136, -29521, -29828, -29985, -29964,
+    -29777, -29483, -29154, -28864, -28642, -28433,
+    -28151, -27768, -27274, -26697, -26040, -25328,
+    -24626, -24026, -23538, -23119, -22718, -22353,
+    -22016, -21654, -21209, -20644, -20016, -19410,
+    -18856, -18352, -17890, -17464, -17092, -16761,
+    -16437, -16077, -15645, -15160, -14622, -14015,
+    -13359, -12685, -12060, -11560, -11160, -10812,
+    -10450, -10072, -9666, -9209, -8679, -8074,
+    -7408, -6759, -6123, -5523, -4962, -4443,
+    -3933, -3430, -2935, -2479, -2076, -1732,
+    -1429, -1123, -760, -265, 372, 1068,
+    1719, 2288, 2751, 3143, 3507, 3892,
+    4341, 4871, 5421, 5950, 6438, 6904,
+    7353, 7801, 8255, 8752, 9299, 9903,
+    10524, 11115, 11651, 12108, 12501, 12851,
+    13187, 13539, 13932, 14368, 14822, 15248,
+    15636, 16012, 16433, 16924, 17517, 18201,
+    18945, 19690, 20390, 20967, 21411, 21736,
+    22026, 22320, 22666, 23095, 23609, 24203,
+    24842, 25450, 25986, 26419, 26791, 27109,
+    27443, 27823, 28288, 28799, 29315, 29718,
+    29960, 30017, 29910, 29679, 29348, 28942,
+    28516, 28077, 27673, 27274, 26860, 26431,
+    25979, 25491, 24960, 24359, 23705, 23061,
+    22451, 21894, 21363, 20853, 20339, 19829,
+    19340, 18883, 18470, 18122, 17809, 17501,
+    17141, 16698, 16171, 15624, 15082, 14558,
+    14052, 13568, 13116, 12693, 12267, 11828,
+    11392, 10933, 10429, 9862, 9266, 8669,
+    8115, 7602, 7096, 6578, 6037, 5482,
+    4935, 4440, 3999, 3621, 3277, 2945,
+    2585, 2180, 1738, 1254, 745, 213,
+    -336, -865, -1385, -1882, -2389, -2923,
+    -3460, -3985, -4516, -5035, -5544, -6019,
+    -6438, -6820, -7174, -7533, -7906, -8296,
+    -8763, -9313, -9936, -10581, -11199, -11766,
+    -12293, -12764, -13182, -13564, -13942, -14364,
+    -14825, -15329, -15849, -16379, -16906, -17428,
+    -17935, -18419, -18909, -19437, -20030, -20663,
+    -21251, -21767, -22188, -22571, -22925, -23306,
+    -23747, -24284, -24897, -25537, -26153, -26729,
+    -27271, -27757, -28196, -28588, -28969, -29368,
+    -29758, -30092, -30301, -30352, -30253, -30008,
+    -29646, -29165, -28616, -28063, -27543, -27047,
+    -26572, -26118, -25698, -25292, -24844, -24303,
+    -23689, -23040, -22425, -21888, -21473, -21157,
+    -20886, -20614, -20280, -19861, -19344, -18737,
+    -18094, -17479, -16936, -16461, -16037, -15619,
+    -15199, -14733, -14225, -13697, -13178, -12715,
+    -12303, -11935, -11572, -11170, -10718, -10210,
+    -9642, -9025, -8386, -7753, -7184, -6674,
+    -6209, -5762, -5338, -4932, -4516, -4054,
+    -3550, -3062, -2600, -2143, -1666, -1178,
+    -705, -221, 294, 855, 1403, 1916,
+    2393, 2869, 3340, 3794, 4277, 4797,
+    5358, 5897, 6375, 6816, 7249, 7688,
+    8525, 9515, 9997, 8792, 4917, -1683,
+    -10090, -19171, -27747, -32768, -32768, -32768,
+    -32768, -32768, -31840, -20880, -7260, 7259,
+    20879, 31839, 32767, 32767, 32767, 32767,
+    31839, 20879, 7259, -7260, -20880, -31840,
+    -32768, -32768, -32768, -32768, -31840, -20880,
+    -7260, 7259, 20879, 31839, 32767, 32767,
+    32767, 32767, 31839, 20879, 7259, -7260,
+    -20880, -31840, -32768, -32768, -32768, -32768,
+    -31840, -20880, -7260, 7259, 20879, 31839,
+    32767, 32767, 32767, 32767, 31839, 20879,
+    7259, -7260, -20880, -31840, -32768, -32768,
+    -32768, -32768, -31840, -20880, -7260, 7259,
+    20879, 31839, 32767, 32767, 32767, 32767,
+    31839, 20879, 7259, -7260, -20880, -31840,
+    -32768, -32768, -32768, -32768, -31840, -20880,
+    -7260, 7259, 20879, 31839, 32767, 32767,
+    32767, 32767, 32767, 30654, 24025, 16928,
+    10199, 4674, 1074, -571, -931, -894,
+    -975, -1364, -1763, -2212, -2737, -3356,
+    -4041, -4725, -5345, -5855, -6284, -6683,
+    -7081, -7533, -8062, -8647, -9261, -9833,
+    -10312, -10710, -11064, -11425, -11825, -12290,
+    -12826, -13424, -14040, -14648, -15208, -15713,
+    -16160, -16536, -16867, -17195, -17556, -17978,
+    -18482, -19045, -19642, -20254, -20849, -21433,
+    -21985, -22498, -23009, -23532, -24073, -24589,
+    -25042, -25435, -25822, -26210, -26627, -27059,
+    -27557, -28133, -28732, -29278, -29731, -30063,
+    -30286, -30355, -30243, -29983, -29654, -29279,
+    -28861, -28364, -27828, -27283, -26753, -26219,
+    -25666, -25114, -24579, -24041, -23492, -22941,
+    -22393, -21882, -21432, -21024, -20653, -20310,
+    -19979, -19661, -19347, -18978, -18494, -17878,
+    -17189, -16491, -15837, -15239, -14695, -14190,
+    -13751, -13344, -12955, -12544, -12124, -11685,
+    -11240, -10772, -10307, -9843, -9419, -9033,
+    -8689, -8345, -7962, -7513, -6994, -6423,
+    -5831, -5213, -4593, -4010, -3483, -3000,
+    -2529, -2058, -1590, -1136, -669, -202,
+    258, 701, 1158, 1649, 2169, 2684,
+    3174, 3677, 4224, 4794, 5375, 5961,
+    6531, 7067, 7539, 7950, 8306, 8651,
+    9013, 9426, 9906, 10463, 11051, 11635,
+    12188, 12660, 13045, 13396, 13752, 14189,
+    14723, 15359, 16052, 16753, 17379, 17902,
+    18331, 18702, 19041, 19371, 19739, 20177,
+    20658, 21171, 21684, 22220, 22787, 23363,
+    23920, 24487, 25059, 25627, 26147, 26589,
+    26968, 27341, 27760, 28242, 28761, 29310,
+    29861, 30331, 30629, 30679, 30522, 30260,
+    29946, 29547, 29035, 28456, 27880, 27331,
+    26814, 26321, 25888, 25504, 25102, 24596,
+    23998, 23362, 22784, 22287, 21887, 21555,
+    21245, 20919, 20522, 20034, 19474, 18851,
+    18200, 17534, 16895, 16316, 15814, 15402,
+    15055, 14726, 14362, 13948, 13468, 12958,
+    12449, 11971, 11513, 11052, 10577, 10077,
+    9547, 8997, 8434, 7893, 7391, 6921,
+    6453, 5994, 5545, 5091, 4606, 4102,
+    3617, 3153, 2662, 2118, 1544, 969,
+    437, -79, -573, -1024, -1424, -1824,
+    -2293, -2839, -3418, -4000, -4561, -5099,
+    -5606, -6078, -6545, -7071, -7640, -8212,
+    -8740, -9205, -9617, -9991, -10334, -10658,
+    -11018, -11438, -11907, -12413, -12948, -13508,
+    -14109, -14743, -15364, -15929, -16428, -16866,
+    -17280, -17705, -18155, -18597, -19022, -19418,
+    -19796, -20173, -20563, -20986, -21451, -21922,
+    -22381, -22826, -23293, -23847, -24498, -25210,
+    -25929, -26602, -27217, -27745,
+};
+
+static const int32_t Expected_CaseFIRQ15Hot[341] = {
+    -31285, -32768, -32768, -32280, -30504, -28483,
+    -27988, -24845, -22997, -21022, -19874, -18552,
+    -16079, -15200, -13759, -10962, -9170, -7791,
+    -6552, -5102, -2686, -271, 2051, 2812,
+    5041, 6808, 9573, 10582, 12636, 14337,
+    14849, 17708, 19269, 21062, 23145, 24870,
+    26190, 28191, 30284, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32187, 29867,
+    27526, 26475, 25411, 23580, 21028, 19232,
+    17487, 16482, 14892, 12396, 10802, 8682,
+    7999, 5065, 2399, 957, -222, -1710,
+    -3737, -6269, -7756, -9534, -10500, -12919,
+    -15112, -16016, -17936, -20809, -21744, -23464,
+    -25291, -27496, -29633, -31211, -32768, -32768,
+    -32768, -32768, -32768, -32768, -32768, -31113,
+    -29384, -27850, -26405, -24375, -22026, -20987,
+    -19530, -17768, -15202, -13159, -12591, -10084,
+    -7964, -5572, -4306, -1744, -1639, 727,
+    3568, 4173, 6320, 8436, 9815, 11662,
+    14137, 15807, 16839, 18476, 19816, 21761,
+    25025, 26882, 27277, 29474, 31719, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767,
+    31047, 28942, 26404, 24967, 22717, 21895,
+    20379, 17807, 16935, 14553, 13442, 10729,
+    9160, 7071, 5100, 3777, 2560, 531,
+    -1269, -3361, -5293, -7155, -8654, -9811,
+    -11678, -14582, -15662, -17609, -18961, -21470,
+    -22660, -25052, -27428, -28144, -30235, -32768,
+    -32768, -32768, -32768, -32768, -32768, -32768,
+    -31861, -30570, -27663, -26136, -25385, -23429,
+    -21006, -19663, -17945, -15754, -14434, -12975,
+    -10737, -8462, -7018, -4926, -3648, -1801,
+    156, 1952, 3723, 5683, 7570, 9122,
+    11044, 12524, -32768, -32768, -32768, -1,
+    32767, 32767, 32767, -32768, -32768, -32768,
+    32767, 32767, 32767, -1, -32768, -32768,
+    -32768, 32767, 32767, 32767, -32768, -32768,
+    -32768, -1, 32767, 32767, 32767, -32768,
+    -32768, -32768, 32767, 32767, 32767, 25200,
+    1078, -834, -1722, -3738, -6065, -8304,
+    -9135, -12165, -13283, -14770, -16731, -19411,
+    -20529, -21821, -23613, -26281, -27975, -29863,
+    -31923, -32653, -32768, -32768, -32768, -32768,
+    -32768, -32202, -30875, -28368, -26740, -25046,
+    -24193, -22660, -19642, -17882, -15922, -14878,
+    -12878, -11339, -10094, -8452, -5920, -3840,
+    -2513, -253, 1027, 2770, 4902, 7123,
+    9070, 10389, 11801, 14051, 16017, 16978,
+    19401, 21840, 23041, 24756, 26394, 28114,
+    30572, 32517, 32767, 32767, 32767, 32767,
+    32767, 32767, 32108, 30834, 28203, 26645,
+    25595, 23626, 21264, 19058, 18063, 16249,
+    14304, 13030, 10363, 8809, 7228, 5612,
+    3120, 2083, -1050, -1635, -3776, -6062,
+    -8000, -9292, -12196, -12481, -14644, -15989,
+    -18600, -20523, -21972, -24037, -24795, -26721,
+    -28381, -30209, -32768, -32768, -32768,
+};
+
+static const int32_t Expected_CaseFIRQ31[256] = {
+    -65012221, -1652886641, -1416755248, -1310091755, -1214373572, -1120122163,
+    -1024150831, -928784827, -833805959, -738496652, -643323869, -547697760,
+    -452565882, -357488313, -261777624, -166767718, -71619830, 23991166,
+    119364622, 214326023, 309534700, 405070245, 500642562, 595438548,
+    690614762, 785974125, 880971584, 976242431, 1071563837, 1167521440,
+    1262922337, 1358136133, 1454213824, 1504556988, 1405356429, 1310007711,
+    1215241837, 1120112327, 1024501346, 929197056, 834338799, 738673278,
+    643611588, 547978491, 452254906, 356873344, 261806687, 167114779,
+    71785439, -23619824, -118799161, -214407672, -309919923, -404812851,
+    -500725483, -595913262, -690829394, -785838282, -881211243, -977176296,
+    -1072228949, -1167390056, -1262548556, -1358027768, -1454313061, -1504894103,
+    -1405882291, -1310410523, -1215065951, -1119407861, -1024803410, -929149333,
+    -833459926, -738411318, -642827240, -548636142, -452979664, -358221919,
+    -261701947, -166705720, -71608453, 24067927, 118576405, 214723948,
+    310443177, 404912810, 500461162, 595471247, 690931443, 786289055,
+    881174259, 976938901, 1071550947, 1167017758, 1262478944, 1358061217,
+    1454846621, 1505094687, 1405721949, 1310882466, 1215193954, 1119551083,
+    1024000759, 928930967, 834003534, 738532298, 643055003, 548072413,
+    452895875, 357549858, 262140525, 166919988, 71782675, -24533527,
+    -118951074, -214507053, -310561096, -405037347, -500537312, -595721854,
+    -690855846, -785909574, -881797017, -977033493, -1072259257, -1167330344,
+    -1263019526, -1357287303, -1453927714, -1504138384, -1406167596, -1310350267,
+    -1215245284, -1120264232, -1024045756, -929227877, -834025601, -738348697,
+    -643016219, -548254405, -452903993, -356963661, -261943566, -167225457,
+    -71468072, 23715652, 118777680, 214132504, 309688903, 405208454,
+    500279659, 595438634, 690477972, 785904942, 881351928, 976821638,
+    1071802064, 1167279106, 1263165289, 1358290613, 1454544116, 1505365879,
+    1405829154, 1310295994, 1214830741, 1118829501, 1024726904, 929102883,
+    833978152, 738756578, 643107800, 548149521, 452180803, 357449995,
+    262130852, 166038605, 71589099, -23260069, -118926142, -214898499,
+    -309535791, -404457492, -500789645, -596161987, -690651058, -786386308,
+    -881416893, -976902262, -1072277217, -1167045618, -1262245414, -1358323950,
+    -1454477668, -1505064749, -1405657396, -1310372362, -1214612730, -1119440690,
+    -1024688054, -929245902, -834244693, -738964147, -642926117, -548387554,
+    -453109575, -357677156, -261611193, -166004332, -71151502, 23631644,
+    118998513, 214229413, 309583988, 404987245, 501020800, 595414112,
+    691272860, 786683006, 881530805, 976493575, 1071913487, 1167298851,
+    1262810820, 1357707587, 1454737617, 1504647048, 1405609887, 1310623319,
+    1214624056, 1119641032, 1024577386, 929136088, 833864194, 738040642,
+    642925876, 547266097, 452846471, 357181930, 262144670, 166992456,
+    71440640, -23689666, -119495069, -214140219, -309486420, -405196650,
+    -500454877, -595367198, -691011948, -786088837, -881596549, -977102417,
+    -1072387684, -1167705040, -1262978733, -1358280339,
+};
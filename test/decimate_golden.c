@@ -0,0 +1,477 @@
+/******************************************************************************
+ * @file:    decimate_golden.c
+ * @purpose: Host-Side Golden-Vector Test and Benchmark of the Decimators
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - Runs Decimate_CIC(), Decimate_FIRQ15() and Decimate_FIRQ31() over fixed,
+ *   integer-generated inputs (fed in irregular block sizes, so state is
+ *   carried between calls) and compares the outputs with the ones checked
+ *   in as decimate_expected.h.
+ *
+ * - Each run is also compared with a direct-form reference written here
+ *   (the CIC as its equivalent boxcar^Order FIR), so a regenerated
+ *   decimate_expected.h can't silently capture a bug.
+ *
+ * - "make -C test regen-decimate" (decimate_golden -g) rewrites
+ *   decimate_expected.h; only do that when an output change is intended,
+ *   and say why in the commit.
+ *
+ * - Then times each filter per input sample, against the reference.
+ *   Host numbers only compare the two; the ARM7's will differ.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "LPC2xxx.h"
+#include "LPC2xxx_decimate.h"
+
+#include "decimate_expected.h"
+
+
+/* Defines ------------------------------------------------------------------*/
+
+#define IN_LEN              (1024)
+#define MAX_TAPS            (64)
+
+/* Largest CIC ratio the reference handles */
+#define REF_CIC_MAX_RATIO   (16)
+
+#ifndef BENCH_LOOPS
+# define BENCH_LOOPS        (2000)
+#endif
+
+#define COUNT_OF(a)         (sizeof(a) / sizeof((a)[0]))
+
+
+/* Variables ----------------------------------------------------------------*/
+
+/* Low-pass, 15 taps, Q15; sums to about 1 */
+static const int16_t TapsQ15[] = {
+     -310,  -420,     0,  1350,  3420,  5480,  6810,  7260,
+     6810,  5480,  3420,  1350,     0,  -420,  -310
+};
+
+/* Gain of about 1.5, to drive the Q15 output into saturation */
+static const int16_t TapsQ15Hot[] = {
+     8192, 16384, 16384,  8192
+};
+
+/* CIC droop compensator, 13 taps, Q31 */
+static const int32_t TapsQ31[] = {
+      -21474836,   53687091, -118111600,  214748365, -429496730,
+      966367642, 1717986918,  966367642, -429496730,  214748365,
+     -118111600,   53687091,  -21474836
+};
+
+/* Block sizes to feed the filters in, cycled through */
+static const uint16_t Blocks[] = { 1, 37, 64, 7, 200, 3, 128, 16 };
+
+static uint16_t AdcIn[IN_LEN];
+static int16_t  Q15In[IN_LEN];
+static int32_t  Q31In[IN_LEN];
+
+static unsigned Checks;
+static unsigned Failures;
+
+/* Keeps the compiler from dropping benchmark work */
+volatile int32_t Sink;
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/* Small LCG, so the inputs are the same everywhere */
+static uint32_t Rand(uint32_t *Seed)
+{
+    *Seed = *Seed * 1664525UL + 1013904223UL;
+
+    return *Seed >> 8;
+}
+
+/* ADC results: a slow triangle plus noise, 10 bits left-justified as
+ *  ADC_RESULT() gives them.  Q15 / Q31: the same shape at full scale,
+ *  with a stretch of +/- full scale square wave for saturation.
+ */
+static void MakeInputs(void)
+{
+    uint32_t Seed = 12345;
+    int32_t Tri;
+    int32_t v;
+    uint32_t i;
+
+
+    for (i = 0; i < IN_LEN; i++) {
+        Tri = (int32_t)(i % 256);
+        Tri = (Tri < 128) ? Tri : 256 - Tri;           /* 0 .. 128 */
+
+        v = 256 + Tri * 4 + (int32_t)(Rand(&Seed) % 64) - 32;
+        AdcIn[i] = (uint16_t)(v << 6);
+
+        v = (Tri - 64) * 400 + (int32_t)(Rand(&Seed) % 2048) - 1024;
+        if ((i >= 600) && (i < 700)) {
+            v = ((i / 10) & 1) ? 32767 : -32768;
+        }
+        Q15In[i] = (int16_t)v;
+
+        Q31In[i] = (int32_t)((uint32_t)(Tri - 64) << 24)
+                   + (int32_t)(Rand(&Seed) % 0x100000) - 0x80000;
+    }
+}
+
+/* Reference CIC: the boxcar^Order FIR, decimated, scaled as the real one */
+static uint16_t RefCIC(uint8_t Order, uint16_t Ratio, const uint16_t *In, uint16_t Len,
+                       int32_t *Out)
+{
+    static int64_t H[DECIMATE_CIC_MAX_ORDER * (REF_CIC_MAX_RATIO - 1) + 1];
+    static int64_t Next[COUNT_OF(H)];
+    uint32_t HLen = 1;
+    uint32_t Gain = 1;
+    uint8_t Shift = 16;
+    uint16_t Count = 0;
+    int64_t Y;
+    uint32_t i, j, k;
+
+
+    if (Ratio > REF_CIC_MAX_RATIO) {
+        return 0;
+    }
+
+    H[0] = 1;
+    for (k = 0; k < Order; k++) {
+        memset(Next, 0, sizeof(Next));
+        for (i = 0; i < HLen; i++) {
+            for (j = 0; j < Ratio; j++) {
+                Next[i + j] += H[i];
+            }
+        }
+        HLen += Ratio - 1;
+        memcpy(H, Next, sizeof(H));
+        Gain *= Ratio;
+    }
+
+    while ((1UL << (16 - Shift)) < Gain) {
+        Shift--;
+    }
+
+    for (i = Ratio - 1; i < Len; i += Ratio) {
+        Y = 0;
+        for (k = 0; (k < HLen) && (k <= i); k++) {
+            Y += H[k] * (int16_t)(In[i - k] ^ 0x8000);
+        }
+        Out[Count++] = (int32_t)((uint32_t)Y << Shift);
+    }
+
+    return Count;
+}
+
+/* Reference Q15 FIR: direct form, rounded, saturated */
+static uint16_t RefFIRQ15(const int16_t *Taps, uint16_t NumTaps, uint16_t Ratio,
+                          const int16_t *In, uint16_t Len, int16_t *Out)
+{
+    uint16_t Count = 0;
+    int64_t Acc;
+    uint32_t i, k;
+
+
+    for (i = Ratio - 1; i < Len; i += Ratio) {
+        Acc = 1 << 14;
+        for (k = 0; (k < NumTaps) && (k <= i); k++) {
+            Acc += (int64_t)Taps[k] * In[i - k];
+        }
+        Acc >>= 15;
+        Out[Count++] = (Acc > 32767) ? 32767 : (Acc < -32768) ? -32768 : (int16_t)Acc;
+    }
+
+    return Count;
+}
+
+/* Reference Q31 FIR: direct form, rounded, saturated */
+static uint16_t RefFIRQ31(const int32_t *Taps, uint16_t NumTaps, uint16_t Ratio,
+                          const int32_t *In, uint16_t Len, int32_t *Out)
+{
+    uint16_t Count = 0;
+    int64_t Acc;
+    uint32_t i, k;
+
+
+    for (i = Ratio - 1; i < Len; i += Ratio) {
+        Acc = 1 << 30;
+        for (k = 0; (k < NumTaps) && (k <= i); k++) {
+            Acc += (int64_t)Taps[k] * In[i - k];
+        }
+        Acc >>= 31;
+        Out[Count++] = (Acc > INT32_MAX) ? INT32_MAX : (Acc < INT32_MIN) ? INT32_MIN
+                                                                         : (int32_t)Acc;
+    }
+
+    return Count;
+}
+
+/* The library filters, fed in Blocks[]-sized pieces */
+static uint16_t RunCIC(uint8_t Order, uint16_t Ratio, const uint16_t *In, uint16_t Len,
+                       int32_t *Out)
+{
+    Decimate_CIC_Type C;
+    uint16_t Count = 0;
+    uint16_t n;
+    unsigned b;
+
+
+    Decimate_CICInit(&C, Order, Ratio);
+    for (b = 0; Len; b++, In += n, Len -= n) {
+        n = (Blocks[b % COUNT_OF(Blocks)] < Len) ? Blocks[b % COUNT_OF(Blocks)] : Len;
+        Count += Decimate_CIC(&C, In, n, &Out[Count]);
+    }
+
+    return Count;
+}
+
+static uint16_t RunFIRQ15(const int16_t *Taps, uint16_t NumTaps, uint16_t Ratio,
+                          const int16_t *In, uint16_t Len, int16_t *Out)
+{
+    Decimate_FIRQ15_Type F;
+    int16_t State[2 * MAX_TAPS];
+    uint16_t Count = 0;
+    uint16_t n;
+    unsigned b;
+
+
+    Decimate_FIRQ15Init(&F, Taps, NumTaps, Ratio, State);
+    for (b = 0; Len; b++, In += n, Len -= n) {
+        n = (Blocks[b % COUNT_OF(Blocks)] < Len) ? Blocks[b % COUNT_OF(Blocks)] : Len;
+        Count += Decimate_FIRQ15(&F, In, n, &Out[Count]);
+    }
+
+    return Count;
+}
+
+static uint16_t RunFIRQ31(const int32_t *Taps, uint16_t NumTaps, uint16_t Ratio,
+                          const int32_t *In, uint16_t Len, int32_t *Out)
+{
+    Decimate_FIRQ31_Type F;
+    int32_t State[2 * MAX_TAPS];
+    uint16_t Count = 0;
+    uint16_t n;
+    unsigned b;
+
+
+    Decimate_FIRQ31Init(&F, Taps, NumTaps, Ratio, State);
+    for (b = 0; Len; b++, In += n, Len -= n) {
+        n = (Blocks[b % COUNT_OF(Blocks)] < Len) ? Blocks[b % COUNT_OF(Blocks)] : Len;
+        Count += Decimate_FIRQ31(&F, In, n, &Out[Count]);
+    }
+
+    return Count;
+}
+
+static void Check(const char *Name, const int32_t *Got, const int32_t *Want,
+                  uint16_t GotLen, uint16_t WantLen, const char *Against)
+{
+    uint16_t i;
+
+
+    Checks++;
+
+    if (GotLen != WantLen) {
+        printf("FAIL: %s: %u outputs, %u from %s\n", Name, GotLen, WantLen, Against);
+        Failures++;
+        return;
+    }
+
+    for (i = 0; i < GotLen; i++) {
+        if (Got[i] != Want[i]) {
+            printf("FAIL: %s: output %u is %ld, %s has %ld\n", Name, i,
+                   (long)Got[i], Against, (long)Want[i]);
+            Failures++;
+            return;
+        }
+    }
+}
+
+static void Emit(const char *Name, const int32_t *Out, uint16_t Len)
+{
+    uint16_t i;
+
+
+    printf("\nstatic const int32_t %s[%u] = {", Name, Len);
+    for (i = 0; i < Len; i++) {
+        printf("%s%ld,", (i % 6) ? " " : "\n    ", (long)Out[i]);
+    }
+    printf("\n};\n");
+}
+
+static double NsPerSample(uint64_t Ns, uint32_t Samples)
+{
+    return (double)Ns / Samples;
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* One test case: runs the library (Ref = 0) or the reference (Ref = 1) */
+typedef struct {
+    const char     *Name;
+    uint16_t      (*Run)(int32_t *Out, int Ref);
+    const char     *ExpectedName;
+    const int32_t  *Expected;
+    uint16_t        ExpectedLen;
+} Case_Type;
+
+/* Widen Q15 results so every case compares as int32_t */
+static uint16_t Widen(const int16_t *In, uint16_t Len, int32_t *Out)
+{
+    uint16_t i;
+
+
+    for (i = 0; i < Len; i++) {
+        Out[i] = In[i];
+    }
+
+    return Len;
+}
+
+static uint16_t CaseCIC3x16(int32_t *Out, int Ref)
+{
+    return (Ref ? RefCIC : RunCIC)(3, 16, AdcIn, IN_LEN, Out);
+}
+
+static uint16_t CaseCIC4x10(int32_t *Out, int Ref)
+{
+    return (Ref ? RefCIC : RunCIC)(4, 10, AdcIn, IN_LEN, Out);
+}
+
+static uint16_t CaseFIRQ15(int32_t *Out, int Ref)
+{
+    int16_t Tmp[IN_LEN];
+
+
+    return Widen(Tmp, (Ref ? RefFIRQ15 : RunFIRQ15)(TapsQ15, COUNT_OF(TapsQ15), 1,
+                                                    Q15In, IN_LEN, Tmp), Out);
+}
+
+static uint16_t CaseFIRQ15Hot(int32_t *Out, int Ref)
+{
+    int16_t Tmp[IN_LEN];
+
+
+    return Widen(Tmp, (Ref ? RefFIRQ15 : RunFIRQ15)(TapsQ15Hot, COUNT_OF(TapsQ15Hot), 3,
+                                                    Q15In, IN_LEN, Tmp), Out);
+}
+
+static uint16_t CaseFIRQ31(int32_t *Out, int Ref)
+{
+    return (Ref ? RefFIRQ31 : RunFIRQ31)(TapsQ31, COUNT_OF(TapsQ31), 4, Q31In, IN_LEN, Out);
+}
+
+#define CASE(Name, Fn)      { Name, Fn, "Expected_" #Fn, Expected_##Fn, \
+                              COUNT_OF(Expected_##Fn) }
+
+static const Case_Type Cases[] = {
+    CASE("CIC order 3, ratio 16",      CaseCIC3x16),
+    CASE("CIC order 4, ratio 10",      CaseCIC4x10),
+    CASE("FIR Q15, 15 taps",           CaseFIRQ15),
+    CASE("FIR Q15, gain 1.5, ratio 3", CaseFIRQ15Hot),
+    CASE("FIR Q31, 13 taps, ratio 4",  CaseFIRQ31),
+};
+
+int main(int argc, char **argv)
+{
+    static int32_t Got[IN_LEN];
+    static int32_t Ref[IN_LEN];
+    uint16_t GotLen;
+    uint16_t RefLen;
+    uint64_t t0, t1, t2;
+    unsigned c, i;
+
+
+    MakeInputs();
+
+    if ((argc > 1) && (strcmp(argv[1], "-g") == 0)) {
+        printf("/* decimate_expected.h : outputs decimate_golden.c checks against.\n"
+               " *\n"
+               " * Generated by \"make -C test regen-decimate\"; don't edit by hand.\n"
+               " */\n");
+        for (c = 0; c < COUNT_OF(Cases); c++) {
+            GotLen = Cases[c].Run(Got, 0);
+            Emit(Cases[c].ExpectedName, Got, GotLen);
+        }
+        return 0;
+    }
+
+    for (c = 0; c < COUNT_OF(Cases); c++) {
+        GotLen = Cases[c].Run(Got, 0);
+        RefLen = Cases[c].Run(Ref, 1);
+        Check(Cases[c].Name, Got, Cases[c].Expected, GotLen, Cases[c].ExpectedLen,
+              "decimate_expected.h");
+        Check(Cases[c].Name, Got, Ref, GotLen, RefLen, "the reference");
+    }
+
+    printf("decimate_golden: %u checks, %u failed\n", Checks, Failures);
+
+    if (Failures) {
+        return 1;
+    }
+
+    printf("  %-28s %12s %12s\n", "ns per input sample:", "library", "reference");
+    for (c = 0; c < COUNT_OF(Cases); c++) {
+        t0 = NowNs();
+        for (i = 0; i < BENCH_LOOPS; i++) {
+            Sink += Cases[c].Run(Got, 0);
+        }
+        t1 = NowNs();
+        for (i = 0; i < BENCH_LOOPS / 10; i++) {
+            Sink += Cases[c].Run(Ref, 1);
+        }
+        t2 = NowNs();
+        printf("  %-28s %12.2f %12.2f\n", Cases[c].Name,
+               NsPerSample(t1 - t0, (uint32_t)BENCH_LOOPS * IN_LEN),
+               NsPerSample(t2 - t1, (uint32_t)(BENCH_LOOPS / 10) * IN_LEN));
+    }
+
+    return 0;
+}
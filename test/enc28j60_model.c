@@ -0,0 +1,662 @@
+/******************************************************************************
+ * @file:    enc28j60_model.c
+ * @purpose: Host-Side Test of the ENC28J60 Driver Against a Chip Model
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - SSP_WriteBlock() / SSP_XferBlock() / SSP_ReadBlock() are replaced by a
+ *   byte-at-a-time model of the chip's SPI opcodes (RCR / WCR / BFS / BFC
+ *   / RBM / WBM / SRC), banked control registers (with the dummy byte on
+ *   MAC / MII reads), the PHY behind MII, and the 8K buffer memory.
+ *
+ * - Chip select is a GPIO_Type in memory, as in spiflash_model.c.
+ *
+ * - Frames are "received" by writing them into the Rx ring the way the
+ *   chip does: next packet pointer, receive status vector, data and FCS,
+ *   wrapping at ERXND and padded to an even address, and only if there's
+ *   room before ERXRDPT.  RBM wraps ERDPT from ERXND to ERXST.
+ *
+ * - Setting TXRTS "sends" ETXST + 1 to ETXND (inclusive) and writes the
+ *   transmit status vector after it.
+ *
+ * - Protocol errors are counted: an even ERXRDPT (errata), ERXRDPT outside
+ *   the ring, ETXND before the frame or leaving no room for the status
+ *   vector, BFS / BFC on a MAC / MII register, and a frame dropped for
+ *   lack of room in the ring when the driver had returned it.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "LPC2xxx.h"
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_gpio.h"
+#include "LPC2xxx_enc28j60.h"
+
+
+/* Defines ------------------------------------------------------------------*/
+
+#define CS_PIN              (1UL << 20)
+
+#define MEM_SIZE            (0x2000)
+#define CHIP_REV            (0x06)
+
+/* Control registers, as bank * 0x20 + address */
+#define R_ERDPTL            (0x00)
+#define R_ERDPTH            (0x01)
+#define R_EWRPTL            (0x02)
+#define R_EWRPTH            (0x03)
+#define R_ETXSTL            (0x04)
+#define R_ETXSTH            (0x05)
+#define R_ETXNDL            (0x06)
+#define R_ETXNDH            (0x07)
+#define R_ERXSTL            (0x08)
+#define R_ERXSTH            (0x09)
+#define R_ERXNDL            (0x0a)
+#define R_ERXNDH            (0x0b)
+#define R_ERXRDPTL          (0x0c)
+#define R_ERXRDPTH          (0x0d)
+#define R_EPKTCNT           (0x39)
+#define R_MACON1            (0x40)
+#define R_MICMD             (0x52)
+#define R_MIREGADR          (0x54)
+#define R_MIWRL             (0x56)
+#define R_MIWRH             (0x57)
+#define R_MIRDL             (0x58)
+#define R_MIRDH             (0x59)
+#define R_MAADR5            (0x60)
+#define R_MISTAT            (0x6a)
+#define R_EREVID            (0x72)
+
+/* Common to all banks (kept in bank 0's slots) */
+#define R_EIR               (0x1c)
+#define R_ESTAT             (0x1d)
+#define R_ECON2             (0x1e)
+#define R_ECON1             (0x1f)
+
+#define EIR_TXERIF          (0x02)
+#define EIR_TXIF            (0x08)
+#define ECON2_AUTOINC       (0x80)
+#define ECON2_PKTDEC        (0x40)
+#define ECON1_TXRTS         (0x08)
+#define ECON1_RXEN          (0x04)
+
+#define PHY_PHCON2          (0x10)
+#define PHY_PHSTAT2         (0x11)
+#define PHCON2_HDLDIS       (0x0100)
+#define PHSTAT2_LSTAT       (0x0400)
+
+#define POOL_SIZE           (4)
+
+
+/* Variables ----------------------------------------------------------------*/
+
+static SSP_Type Ssp;
+static GPIO_Type Port;
+static ENC28J60_Type E;
+static ENC28J60_Packet_Type Pool[POOL_SIZE];
+
+static const uint8_t Mac[6] = { 0x02, 0x11, 0x22, 0x33, 0x44, 0x55 };
+
+/* The chip */
+static struct {
+    uint8_t   Mem[MEM_SIZE];
+    uint8_t   Reg[4 * 0x20];
+    uint16_t  Phy[0x20];
+    uint8_t   RdPtL;                     /* ERXRDPTL, held until ERXRDPTH  */
+    uint16_t  RxRdPt;                    /* ERXRDPT as the chip sees it    */
+    uint16_t  RxWrPt;                    /* Where the next frame goes      */
+    uint8_t   FailTx;                    /* Make the next transmit fail    */
+
+    uint8_t   Selected;
+    uint8_t   Op;
+    uint8_t   Arg;
+    uint32_t  Index;
+
+    uint8_t   Wire[ENC28J60_MAX_FRAME];  /* Last frame sent                */
+    uint16_t  WireLen;
+    uint8_t   WireCtrl;                  /* Its per-packet control byte    */
+    unsigned  Sent;
+    unsigned  Dropped;
+    unsigned  Errors;
+} Chip;
+
+static unsigned Checks;
+static unsigned Failures;
+
+
+/* Functions ----------------------------------------------------------------*/
+
+static void ChipError(const char *What, unsigned Value)
+{
+    printf("  chip: %s (0x%04x)\n", What, Value);
+    Chip.Errors++;
+}
+
+static uint16_t Reg16(uint8_t RegL)
+{
+    return Chip.Reg[RegL] | (Chip.Reg[RegL + 1] << 8);
+}
+
+static void SetReg16(uint8_t RegL, uint16_t Value)
+{
+    Chip.Reg[RegL]     = Value;
+    Chip.Reg[RegL + 1] = Value >> 8;
+}
+
+/* MAC and MII registers clock out a dummy byte before their data */
+static int IsMacReg(uint8_t Reg)
+{
+    uint8_t Bank = Reg >> 5;
+    uint8_t Addr = Reg & 0x1f;
+
+
+    return (Addr < 0x1b) && ((Bank == 2) || ((Bank == 3) && ((Addr <= 0x05) || (Addr == 0x0a))));
+}
+
+/* The register an opcode's argument means with the current bank */
+static uint8_t RegFor(uint8_t Arg)
+{
+    if (Arg >= 0x1b) {
+        return Arg;
+    }
+
+    return ((Chip.Reg[R_ECON1] & 0x03) << 5) | Arg;
+}
+
+static void ChipReset(void)
+{
+    memset(Chip.Reg, 0, sizeof(Chip.Reg));
+    Chip.Reg[R_ESTAT]  = 0x01;           /* CLKRDY */
+    Chip.Reg[R_ECON2]  = ECON2_AUTOINC;
+    Chip.Reg[R_EREVID] = CHIP_REV;
+    SetReg16(R_ERXNDL, 0x1fff);
+    SetReg16(R_ERXRDPTL, 0x05fa);
+    Chip.RxRdPt = 0x05fa;
+    Chip.RxWrPt = 0;
+    Chip.Phy[PHY_PHCON2] = 0;
+}
+
+/* Free bytes in the Rx ring, as the chip works it out */
+static uint16_t RxFree(void)
+{
+    uint16_t Start = Reg16(R_ERXSTL);
+    uint16_t End = Reg16(R_ERXNDL);
+
+
+    if (Chip.RxWrPt > Chip.RxRdPt) {
+        return (End - Start) - (Chip.RxWrPt - Chip.RxRdPt);
+    } else if (Chip.RxWrPt == Chip.RxRdPt) {
+        return End - Start;
+    }
+
+    return Chip.RxRdPt - Chip.RxWrPt - 1;
+}
+
+/* Put a frame on the wire for the chip to receive */
+static void ChipReceive(const uint8_t *Frame, uint16_t Len, int Ok)
+{
+    uint16_t Start = Reg16(R_ERXSTL);
+    uint16_t End = Reg16(R_ERXNDL);
+    uint16_t Count = Len + 4;            /* With the FCS */
+    uint16_t Total = 6 + Count + (Count & 1);
+    uint16_t Next;
+    uint16_t p = Chip.RxWrPt;
+    uint8_t Hdr[6];
+    uint32_t i;
+
+
+    if (!(Chip.Reg[R_ECON1] & ECON1_RXEN) || (Total > RxFree())) {
+        Chip.Dropped++;
+        return;
+    }
+
+    Next = Chip.RxWrPt + Total;
+    if (Next > End) {
+        Next = Next - (End - Start + 1);
+    }
+
+    Hdr[0] = Next;
+    Hdr[1] = Next >> 8;
+    Hdr[2] = Count;
+    Hdr[3] = Count >> 8;
+    Hdr[4] = Ok ? 0x80 : 0x00;           /* Received OK */
+    Hdr[5] = 0x00;
+
+    for (i = 0; i < 6u + Count; i++) {
+        Chip.Mem[p] = (i < 6) ? Hdr[i] : (i < 6u + Len) ? Frame[i - 6] : 0xcc;
+        p = (p == End) ? Start : p + 1;
+    }
+
+    Chip.RxWrPt = Next;
+    Chip.Reg[R_EPKTCNT]++;
+}
+
+/* TXRTS set: send ETXST + 1 .. ETXND */
+static void ChipTransmit(void)
+{
+    uint16_t Start = Reg16(R_ETXSTL);
+    uint16_t End = Reg16(R_ETXNDL);
+    uint32_t i;
+
+
+    if ((End <= Start) || (End - Start > ENC28J60_MAX_FRAME) || (End + 7 >= MEM_SIZE)) {
+        ChipError("bad ETXND", End);
+        Chip.Reg[R_ECON1] &= ~ECON1_TXRTS;
+        return;
+    }
+
+    Chip.WireCtrl = Chip.Mem[Start];
+    Chip.WireLen  = End - Start;
+    memcpy(Chip.Wire, &Chip.Mem[Start + 1], Chip.WireLen);
+
+    /* Transmit status vector */
+    for (i = 1; i <= 7; i++) {
+        Chip.Mem[End + i] = 0xee;
+    }
+
+    Chip.Sent++;
+    Chip.Reg[R_EIR] |= Chip.FailTx ? EIR_TXERIF : EIR_TXIF;
+    Chip.FailTx = 0;
+    Chip.Reg[R_ECON1] &= ~ECON1_TXRTS;
+}
+
+static void ChipWriteReg(uint8_t Reg, uint8_t Value)
+{
+    uint16_t RdPt;
+
+
+    if (Reg == R_EPKTCNT) {
+        return;
+    }
+
+    Chip.Reg[Reg] = Value;
+
+    switch (Reg) {
+        case R_ERXRDPTL:
+            /* Held until the high byte is written */
+            Chip.RdPtL = Value;
+            break;
+
+        case R_ERXRDPTH:
+            RdPt = Chip.RdPtL | (Value << 8);
+            if (!(RdPt & 1)) {
+                ChipError("ERXRDPT even (errata)", RdPt);
+            }
+            if ((RdPt < Reg16(R_ERXSTL)) || (RdPt > Reg16(R_ERXNDL))) {
+                ChipError("ERXRDPT outside the Rx ring", RdPt);
+            }
+            Chip.RxRdPt = RdPt;
+            break;
+
+        case R_ERXSTL:
+        case R_ERXSTH:
+            Chip.RxWrPt = Reg16(R_ERXSTL);
+            break;
+
+        case R_MICMD:
+            if (Value & 0x01) {
+                SetReg16(R_MIRDL, Chip.Phy[Chip.Reg[R_MIREGADR] & 0x1f]);
+            }
+            break;
+
+        case R_MIWRH:
+            Chip.Phy[Chip.Reg[R_MIREGADR] & 0x1f] = Reg16(R_MIWRL);
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void ChipBitOp(uint8_t Reg, uint8_t Bits, int Set)
+{
+    if (IsMacReg(Reg)) {
+        ChipError("BFS / BFC on a MAC / MII register", Reg);
+        return;
+    }
+
+    if (!Set) {
+        Chip.Reg[Reg] &= ~Bits;
+        return;
+    }
+
+    Chip.Reg[Reg] |= Bits;
+
+    if ((Reg == R_ECON2) && (Bits & ECON2_PKTDEC)) {
+        Chip.Reg[R_ECON2] &= ~ECON2_PKTDEC;
+        if (Chip.Reg[R_EPKTCNT]) {
+            Chip.Reg[R_EPKTCNT]--;
+        } else {
+            ChipError("PKTDEC with no frames", 0);
+        }
+    }
+    if ((Reg == R_ECON1) && (Bits & ECON1_TXRTS)) {
+        ChipTransmit();
+    }
+}
+
+/* Next buffer memory address after an RBM / WBM byte */
+static uint16_t NextAddr(uint16_t Addr, int Read)
+{
+    if (!(Chip.Reg[R_ECON2] & ECON2_AUTOINC)) {
+        return Addr;
+    }
+    if (Read && (Addr == Reg16(R_ERXNDL))) {
+        return Reg16(R_ERXSTL);
+    }
+
+    return (Addr + 1) & (MEM_SIZE - 1);
+}
+
+static void ChipSelect(void)
+{
+    Chip.Selected = 1;
+    Chip.Index = 0;
+}
+
+static void ChipDeselect(void)
+{
+    Chip.Selected = 0;
+    if ((Chip.Index > 0) && (Chip.Op == 0xff)) {
+        ChipReset();
+    }
+}
+
+/* Pick up chip select edges from the driver's GPIO writes */
+static void ModelSync(void)
+{
+    if (Port.SET & CS_PIN) {
+        Port.SET = 0;
+        if (Chip.Selected) {
+            ChipDeselect();
+        }
+    }
+
+    if (Port.CLR & CS_PIN) {
+        Port.CLR = 0;
+        ChipSelect();
+    }
+}
+
+/* One byte each way */
+static uint8_t ChipXfer(uint8_t Out)
+{
+    uint32_t n = Chip.Index++;
+    uint8_t Reg;
+    uint16_t Addr;
+    uint8_t In = 0xff;
+
+
+    if (!Chip.Selected) {
+        ChipError("byte clocked with CS high", Out);
+        return 0xff;
+    }
+
+    if (n == 0) {
+        Chip.Op  = (Out == 0xff) ? 0xff : (Out & 0xe0);
+        Chip.Arg = Out & 0x1f;
+        if ((Out & 0xe0) == 0x20) {
+            Chip.Op = 0x20;              /* RBM; argument must be 0x1a */
+        } else if ((Out & 0xe0) == 0x60) {
+            Chip.Op = 0x60;              /* WBM */
+        }
+        return 0xff;
+    }
+
+    Reg = RegFor(Chip.Arg);
+
+    switch (Chip.Op) {
+        case 0x00:                       /* RCR */
+            if (IsMacReg(Reg) && (n == 1)) {
+                In = 0x00;               /* Dummy byte */
+            } else {
+                In = Chip.Reg[Reg];
+            }
+            break;
+
+        case 0x40:                       /* WCR */
+            if (n == 1) {
+                ChipWriteReg(Reg, Out);
+            }
+            break;
+
+        case 0x80:                       /* BFS */
+        case 0xa0:                       /* BFC */
+            if (n == 1) {
+                ChipBitOp(Reg, Out, Chip.Op == 0x80);
+            }
+            break;
+
+        case 0x20:                       /* RBM */
+            Addr = Reg16(R_ERDPTL);
+            In = Chip.Mem[Addr];
+            SetReg16(R_ERDPTL, NextAddr(Addr, 1));
+            break;
+
+        case 0x60:                       /* WBM */
+            Addr = Reg16(R_EWRPTL);
+            Chip.Mem[Addr] = Out;
+            SetReg16(R_EWRPTL, NextAddr(Addr, 0));
+            break;
+
+        default:
+            break;
+    }
+
+    return In;
+}
+
+/* The driver's view of the SSP */
+void SSP_XferBlock(SSP_Type *SSP, const void *TxData, void *RxData, uint32_t Count)
+{
+    const uint8_t *Tx = TxData;
+    uint8_t *Rx = RxData;
+    uint8_t In;
+
+
+    (void)SSP;
+    ModelSync();
+
+    while (Count--) {
+        In = ChipXfer(Tx ? *Tx++ : 0xff);
+        if (Rx) {
+            *Rx++ = In;
+        }
+    }
+}
+
+void SSP_WriteBlock(SSP_Type *SSP, const void *TxData, uint32_t Count)
+{
+    SSP_XferBlock(SSP, TxData, 0, Count);
+}
+
+void SSP_ReadBlock(SSP_Type *SSP, void *RxData, uint32_t Count)
+{
+    SSP_XferBlock(SSP, 0, RxData, Count);
+}
+
+static void Check(int Ok, const char *What)
+{
+    Checks++;
+    if (!Ok) {
+        printf("FAIL: %s\n", What);
+        Failures++;
+    }
+}
+
+static void Poll(void)
+{
+    ENC28J60_Poll(&E);
+    ModelSync();
+}
+
+/* Frame number n: length and contents */
+static uint16_t FrameLen(unsigned n)
+{
+    static const uint16_t Lens[] = { 60, 1518, 61, 777, 1023, 64, 1517, 333 };
+
+
+    return Lens[n % (sizeof(Lens) / sizeof(Lens[0]))];
+}
+
+static void MakeFrame(unsigned n, uint8_t *Frame)
+{
+    uint16_t i;
+
+
+    for (i = 0; i < FrameLen(n); i++) {
+        Frame[i] = (uint8_t)(n * 31 + i * 7);
+    }
+}
+
+int main(void)
+{
+    static uint8_t Frame[ENC28J60_MAX_FRAME];
+    ENC28J60_Packet_Type *P;
+    unsigned Good;
+    unsigned n;
+    unsigned i;
+
+
+    /* Init */
+    ChipReset();
+    Check(ENC28J60_Init(&E, &Ssp, &Port, CS_PIN, Mac, Pool, POOL_SIZE) == CHIP_REV,
+          "revision ID read back");
+    ModelSync();
+    Check((Reg16(R_ERXSTL) == 0x0000) && (Reg16(R_ERXNDL) == 0x19ff),
+          "Rx ring at 0x0000 - 0x19ff");
+    Check(Chip.RxRdPt == 0x19ff, "ERXRDPT starts at ERXND");
+    Check(Chip.Reg[R_ECON1] & ECON1_RXEN, "receive enabled");
+    Check(Chip.Reg[R_MACON1] & 0x01, "MAC receive enabled");
+    Check((Chip.Reg[R_MAADR5 + 4] == Mac[0]) && (Chip.Reg[R_MAADR5 + 1] == Mac[5]),
+          "MAC address loaded");
+    Check(Chip.Phy[PHY_PHCON2] == PHCON2_HDLDIS, "PHY loopback disabled");
+
+    /* Enough frames to go round the Rx ring several times, each read back
+     *  before the next arrives
+     */
+    Good = 0;
+    for (n = 0; n < 60; n++) {
+        MakeFrame(n, Frame);
+        ChipReceive(Frame, FrameLen(n), 1);
+        Poll();
+
+        P = ENC28J60_Recv(&E);
+        if (P && (P->Len == FrameLen(n)) && (memcmp(P->Data, Frame, P->Len) == 0)) {
+            Good++;
+        }
+        if (P) {
+            ENC28J60_Free(&E, P);
+        }
+    }
+    Check(Good == 60, "60 frames round the ring, all intact");
+    Check(Chip.Dropped == 0, "none dropped for lack of room");
+    Check(Chip.Reg[R_EPKTCNT] == 0, "EPKTCNT back to 0");
+    Check(Chip.RxRdPt == ((E.RxNext == 0) ? 0x19ff : E.RxNext - 1),
+          "ERXRDPT just behind the next frame");
+
+    /* More frames waiting than packets: the rest stay in the chip */
+    for (n = 0; n < POOL_SIZE + 2; n++) {
+        MakeFrame(n, Frame);
+        ChipReceive(Frame, FrameLen(n + 2) / 4, 1);
+    }
+    Poll();
+    Check(Chip.Reg[R_EPKTCNT] == 2, "frames left in the chip when the pool runs dry");
+    for (i = 0; (i < POOL_SIZE) && ((P = ENC28J60_Recv(&E)) != 0); i++) {
+        ENC28J60_Free(&E, P);
+    }
+    Check(i == POOL_SIZE, "pool's worth of frames read");
+    Poll();
+    Check(Chip.Reg[R_EPKTCNT] == 0, "left-over frames read once packets are freed");
+    while ((P = ENC28J60_Recv(&E)) != 0) {
+        ENC28J60_Free(&E, P);
+    }
+
+    /* A bad frame is dropped and its space handed back */
+    ChipReceive(Frame, 100, 0);
+    Poll();
+    Check((ENC28J60_Recv(&E) == 0) && (E.RxErrors == 1), "bad frame dropped");
+    Check(Chip.Reg[R_EPKTCNT] == 0, "bad frame's space returned");
+
+    /* Transmit */
+    for (n = 0; n < 3; n++) {
+        P = ENC28J60_Alloc(&E);
+        MakeFrame(n, P->Data);
+        P->Len = FrameLen(n);
+        Check(ENC28J60_Send(&E, P), "frame queued");
+        Poll();
+        Check((Chip.Sent == n + 1) && (Chip.WireLen == FrameLen(n))
+              && (memcmp(Chip.Wire, P->Data, Chip.WireLen) == 0)
+              && (Chip.WireCtrl == 0x00),
+              "frame sent with ETXND on its last byte");
+        Poll();
+    }
+    Check(E.TxFrames == 3, "3 frames counted sent");
+
+    /* A failed transmit is counted, and the next one resets the Tx logic */
+    Chip.FailTx = 1;
+    P = ENC28J60_Alloc(&E);
+    P->Len = 60;
+    ENC28J60_Send(&E, P);
+    Poll();
+    Poll();
+    Check(E.TxErrors == 1, "failed transmit counted");
+    P = ENC28J60_Alloc(&E);
+    P->Len = 60;
+    ENC28J60_Send(&E, P);
+    Poll();
+    Check(!(Chip.Reg[R_EIR] & EIR_TXERIF), "TXERIF cleared before the next transmit");
+    Poll();
+    for (n = 0; ENC28J60_Alloc(&E); n++);
+    Check(n == POOL_SIZE, "every packet back in the pool");
+
+    /* Link status via the PHY */
+    Chip.Phy[PHY_PHSTAT2] = PHSTAT2_LSTAT;
+    Check(ENC28J60_LinkIsUp(&E) == 1, "link up");
+    Chip.Phy[PHY_PHSTAT2] = 0;
+    Check(ENC28J60_LinkIsUp(&E) == 0, "link down");
+    ModelSync();
+
+    Check(Chip.Errors == 0, "no protocol errors");
+
+    printf("enc28j60_model: %u checks, %u failed\n", Checks, Failures);
+
+    return Failures ? 1 : 0;
+}
@@ -0,0 +1,386 @@
+/******************************************************************************
+ * @file:    spiflash_model.c
+ * @purpose: Host-Side Test of the SPI Flash Driver Against a Chip Model
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - SSP_WriteBlock() / SSP_XferBlock() / SSP_ReadBlock() are replaced by a
+ *   byte-at-a-time model of a 25-series chip: JEDEC ID, RDSR, WREN,
+ *   FAST_READ (one dummy byte before data), PAGE_PROGRAM (wraps within
+ *   the page, like the real thing) and SECTOR_ERASE.
+ *
+ * - Chip select is a GPIO_Type in memory; the driver's writes to its CLR /
+ *   SET registers are picked up at the next SSP call (or ModelSync()) as
+ *   the start / end of a command, and programs / erases take effect on
+ *   the rising edge as on a real chip.
+ *
+ * - After a program or erase the chip stays busy for a number of status
+ *   reads, so WIP polling actually has to poll.
+ *
+ * - Anything a real chip would ignore or get wrong is counted as a
+ *   protocol error: a command other than RDSR while busy, a program or
+ *   erase without WREN, or a page program running past its page.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "LPC2xxx.h"
+#include "LPC2xxx_ssp.h"
+#include "LPC2xxx_gpio.h"
+#include "LPC2xxx_spiflash.h"
+
+
+/* Defines ------------------------------------------------------------------*/
+
+#define FLASH_SIZE          (0x10000)
+#define FLASH_ID            (0xef4017UL)
+
+#define CS_PIN              (1UL << 7)
+
+/* Status reads a program / erase stays busy for */
+#define PROGRAM_POLLS       (3)
+#define ERASE_POLLS         (20)
+
+
+/* Variables ----------------------------------------------------------------*/
+
+static SSP_Type Ssp;
+static GPIO_Type Port;
+static SPIFlash_Type F;
+
+/* The chip */
+static struct {
+    uint8_t   Mem[FLASH_SIZE];
+    uint8_t   Page[SPIFLASH_PAGE_SIZE];  /* Page program buffer            */
+    uint8_t   Selected;
+    uint8_t   Cmd;
+    uint32_t  Index;                     /* Bytes so far in this command   */
+    uint32_t  Addr;
+    uint8_t   Wel;
+    uint32_t  Busy;                      /* Status reads until done        */
+
+    /* What it saw */
+    unsigned  FastReads;
+    unsigned  PagePrograms;
+    unsigned  StatusReads;
+    unsigned  Errors;
+} Chip;
+
+static unsigned Checks;
+static unsigned Failures;
+
+
+/* Functions ----------------------------------------------------------------*/
+
+static void ChipError(const char *What)
+{
+    printf("  chip: %s (command 0x%02x)\n", What, Chip.Cmd);
+    Chip.Errors++;
+}
+
+/* Chip select went low */
+static void ChipSelect(void)
+{
+    Chip.Selected = 1;
+    Chip.Index    = 0;
+    Chip.Addr     = 0;
+    memset(Chip.Page, 0xff, sizeof(Chip.Page));
+}
+
+/* Chip select went high: finish the command */
+static void ChipDeselect(void)
+{
+    uint32_t Base;
+    uint32_t i;
+
+
+    Chip.Selected = 0;
+
+    if (Chip.Index == 0) {
+        return;
+    }
+
+    switch (Chip.Cmd) {
+        case SPIFLASH_CMD_WRITE_ENABLE:
+            Chip.Wel = 1;
+            break;
+
+        case SPIFLASH_CMD_PAGE_PROGRAM:
+            if (Chip.Index < 5) {
+                break;
+            }
+            Base = Chip.Addr & ~(SPIFLASH_PAGE_SIZE - 1) & (FLASH_SIZE - 1);
+            for (i = 0; i < SPIFLASH_PAGE_SIZE; i++) {
+                Chip.Mem[Base + i] &= Chip.Page[i];
+            }
+            Chip.PagePrograms++;
+            Chip.Busy = PROGRAM_POLLS;
+            Chip.Wel  = 0;
+            break;
+
+        case SPIFLASH_CMD_SECTOR_ERASE:
+            if (Chip.Index != 4) {
+                ChipError("erase with wrong length");
+                break;
+            }
+            Base = Chip.Addr & ~(SPIFLASH_SECTOR_SIZE - 1) & (FLASH_SIZE - 1);
+            memset(&Chip.Mem[Base], 0xff, SPIFLASH_SECTOR_SIZE);
+            Chip.Busy = ERASE_POLLS;
+            Chip.Wel  = 0;
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* Pick up chip select edges from the driver's GPIO writes */
+static void ModelSync(void)
+{
+    if (Port.SET & CS_PIN) {
+        Port.SET = 0;
+        if (Chip.Selected) {
+            ChipDeselect();
+        }
+    }
+
+    if (Port.CLR & CS_PIN) {
+        Port.CLR = 0;
+        ChipSelect();
+    }
+}
+
+/* One byte each way */
+static uint8_t ChipXfer(uint8_t Out)
+{
+    uint32_t n = Chip.Index++;
+    uint8_t In = 0xff;
+
+
+    if (!Chip.Selected) {
+        printf("  chip: byte clocked with CS high\n");
+        Chip.Errors++;
+        return 0xff;
+    }
+
+    if (n == 0) {
+        Chip.Cmd = Out;
+
+        if (Chip.Busy && (Out != SPIFLASH_CMD_READ_STATUS)) {
+            ChipError("command while busy");
+        }
+        if (((Out == SPIFLASH_CMD_PAGE_PROGRAM) || (Out == SPIFLASH_CMD_SECTOR_ERASE))
+         && !Chip.Wel)
+        {
+            ChipError("program / erase without WREN");
+        }
+        if (Out == SPIFLASH_CMD_FAST_READ) {
+            Chip.FastReads++;
+        }
+        return 0xff;
+    }
+
+    switch (Chip.Cmd) {
+        case SPIFLASH_CMD_JEDEC_ID:
+            if (n <= 3) {
+                In = FLASH_ID >> (8 * (3 - n));
+            }
+            break;
+
+        case SPIFLASH_CMD_READ_STATUS:
+            Chip.StatusReads++;
+            In = (Chip.Busy ? SPIFLASH_STATUS_BUSY : 0) | (Chip.Wel ? SPIFLASH_STATUS_WEL : 0);
+            if (Chip.Busy) {
+                Chip.Busy--;
+            }
+            break;
+
+        case SPIFLASH_CMD_FAST_READ:
+        case SPIFLASH_CMD_PAGE_PROGRAM:
+        case SPIFLASH_CMD_SECTOR_ERASE:
+            if (n <= 3) {
+                Chip.Addr = (Chip.Addr << 8) | Out;
+            } else if (Chip.Cmd == SPIFLASH_CMD_FAST_READ) {
+                /* Byte 4 is the dummy; what's sent back during it is junk */
+                In = (n == 4) ? 0x5a : Chip.Mem[(Chip.Addr + n - 5) & (FLASH_SIZE - 1)];
+            } else if (Chip.Cmd == SPIFLASH_CMD_PAGE_PROGRAM) {
+                /* Wraps to the start of the page, as on the real chip */
+                if (((Chip.Addr & (SPIFLASH_PAGE_SIZE - 1)) + (n - 4)) == SPIFLASH_PAGE_SIZE) {
+                    ChipError("page program ran past the end of the page");
+                }
+                Chip.Page[(Chip.Addr + n - 4) & (SPIFLASH_PAGE_SIZE - 1)] = Out;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return In;
+}
+
+/* The driver's view of the SSP */
+void SSP_XferBlock(SSP_Type *SSP, const void *TxData, void *RxData, uint32_t Count)
+{
+    const uint8_t *Tx = TxData;
+    uint8_t *Rx = RxData;
+    uint8_t In;
+
+
+    (void)SSP;
+    ModelSync();
+
+    while (Count--) {
+        In = ChipXfer(Tx ? *Tx++ : 0xff);
+        if (Rx) {
+            *Rx++ = In;
+        }
+    }
+}
+
+void SSP_WriteBlock(SSP_Type *SSP, const void *TxData, uint32_t Count)
+{
+    SSP_XferBlock(SSP, TxData, 0, Count);
+}
+
+void SSP_ReadBlock(SSP_Type *SSP, void *RxData, uint32_t Count)
+{
+    SSP_XferBlock(SSP, 0, RxData, Count);
+}
+
+static void Check(int Ok, const char *What)
+{
+    Checks++;
+    if (!Ok) {
+        printf("FAIL: %s\n", What);
+        Failures++;
+    }
+}
+
+/* Run a program / erase to completion */
+static unsigned WaitIdle(void)
+{
+    unsigned Polls = 0;
+
+
+    while (SPIFlash_Poll(&F)) {
+        Polls++;
+    }
+    ModelSync();
+
+    return Polls;
+}
+
+int main(void)
+{
+    static uint8_t Data[600];
+    static uint8_t Back[600];
+    unsigned Polls;
+    unsigned Before;
+    uint32_t Id;
+    uint32_t i;
+
+
+    memset(Chip.Mem, 0x00, sizeof(Chip.Mem));
+    for (i = 0; i < sizeof(Data); i++) {
+        Data[i] = (uint8_t)(i * 7 + 3);
+    }
+
+    Id = SPIFlash_Init(&F, &Ssp, &Port, CS_PIN);
+    Check(Id == FLASH_ID, "JEDEC ID read back");
+    Check(!SPIFlash_IsBusy(&F), "idle after init");
+
+    /* Erase: has to wait out the busy status reads */
+    Before = Chip.StatusReads;
+    Check(SPIFlash_EraseSector(&F, 0x0123), "erase started");
+    Check(!SPIFlash_EraseSector(&F, 0x1000), "second erase refused while busy");
+    Polls = WaitIdle();
+    Check(Polls >= ERASE_POLLS - 1, "erase polled until WIP cleared");
+    Check(Chip.StatusReads - Before <= ERASE_POLLS + 2, "no extra status reads");
+    for (i = 0; (i < SPIFLASH_SECTOR_SIZE) && (Chip.Mem[i] == 0xff); i++);
+    Check(i == SPIFLASH_SECTOR_SIZE, "sector erased");
+    Check(Chip.Mem[SPIFLASH_SECTOR_SIZE] == 0x00, "next sector untouched");
+
+    /* A write across three page boundaries, split on them */
+    Check(SPIFlash_Write(&F, 0x0f0, Data, sizeof(Data)), "write started");
+    WaitIdle();
+    Check(Chip.PagePrograms == 4, "600 bytes at 0x0f0 took 4 page programs");
+    Check(memcmp(&Chip.Mem[0x0f0], Data, sizeof(Data)) == 0, "written data in place");
+    Check((Chip.Mem[0x0ef] == 0xff) && (Chip.Mem[0x0f0 + sizeof(Data)] == 0xff),
+          "bytes either side of the write untouched");
+
+    /* Reads: one big one straight through, then small ones via the line */
+    memset(Back, 0, sizeof(Back));
+    Before = Chip.FastReads;
+    SPIFlash_Read(&F, 0x0f0, Back, sizeof(Back));
+    Check(memcmp(Back, Data, sizeof(Back)) == 0, "large read matches");
+    Check(Chip.FastReads - Before == 1, "large read is one FAST_READ");
+
+    memset(Back, 0, sizeof(Back));
+    Before = Chip.FastReads;
+    for (i = 0; i < 128; i += 4) {
+        SPIFlash_Read(&F, 0x101 + i, &Back[i], 4);
+    }
+    Check(memcmp(Back, &Data[0x101 - 0x0f0], 128) == 0, "record reads match");
+    Check(Chip.FastReads - Before == 128 / SPIFLASH_LINE_SIZE,
+          "record reads cost one FAST_READ per line");
+
+    SPIFlash_Read(&F, 0x0f3, Back, 5);
+    Check(memcmp(Back, &Data[3], 5) == 0, "read behind the cached line");
+
+    /* A write drops the line; a read during a write waits for it */
+    SPIFlash_Read(&F, 0x400, Back, 4);
+    Check(SPIFlash_Write(&F, 0x400, "\x12\x34\x56\x78", 4), "second write started");
+    SPIFlash_Read(&F, 0x400, Back, 4);
+    Check(memcmp(Back, "\x12\x34\x56\x78", 4) == 0, "read after write sees new data");
+    Check(!SPIFlash_IsBusy(&F), "read waited for the program");
+
+    /* Reset in the middle of an erase: the ID is only readable after it */
+    Chip.Busy = 5;
+    Id = SPIFlash_Init(&F, &Ssp, &Port, CS_PIN);
+    Check((Id == FLASH_ID) && !Chip.Busy, "init waits out an erase in progress");
+    Check(!SPIFlash_IsBusy(&F), "idle after that init");
+
+    Check(Chip.Errors == 0, "no protocol errors");
+
+    printf("spiflash_model: %u checks, %u failed\n", Checks, Failures);
+
+    return Failures ? 1 : 0;
+}
@@ -0,0 +1,179 @@
+/******************************************************************************
+ * @file:    uart_baud_sweep.c
+ * @purpose: Host-Side Sweep of the UART Baud Rate Solver
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - Runs UART_CalcBaudConfig() over every F_CPU the PLL makes from a 12MHz
+ *   or 14.7456MHz crystal (up to 60MHz), APB dividers 1 / 2 / 4 and the
+ *   usual rates from 9600 to 921600 baud, next to the old
+ *   round(PCLK / 16 / baud) divisor.
+ *
+ * - A rate has a solution when PCLK >= 48 * baud, i.e. a divisor of at
+ *   least 3 (the fractional divider's minimum) is possible.  Every such
+ *   rate must come out within MAX_ERROR_PPM; every rate at all must come
+ *   out no worse than the old rounding.
+ *
+ * - Without -DLPC2XXX_PART_01 the solver is integer-only, so only the
+ *   "no worse than before" check is made.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart.h"
+
+
+/* Defines ------------------------------------------------------------------*/
+
+/* Worst error allowed on a rate with a solution: 0.16%, to two places */
+#ifndef MAX_ERROR_PPM
+# define MAX_ERROR_PPM      (1650)
+#endif
+
+#define COUNT_OF(a)         (sizeof(a) / sizeof((a)[0]))
+
+
+/* Variables ----------------------------------------------------------------*/
+
+/* Referenced by UART_SetBaudRate(), which isn't run here */
+uint32_t SystemCoreClock;
+
+static const uint32_t Crystals[] = { 12000000, 14745600 };
+static const uint32_t APBDividers[] = { 1, 2, 4 };
+static const uint32_t Bauds[] = {
+    9600, 19200, 38400, 57600, 115200, 230400, 460800, 921600
+};
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/* |PClk / (16 * Divisor * (1 + DivAddVal / MulVal)) - Baud| / Baud, in ppm */
+static double ErrorPPM(uint32_t PClk, uint32_t Baud, const UART_BaudConfig_Type *Config)
+{
+    double Actual;
+    double Err;
+
+
+    if (Config->Divisor == 0) {
+        return 1e6;
+    }
+
+    Actual = (double)PClk * Config->MulVal
+             / (16.0 * Config->Divisor * (Config->MulVal + Config->DivAddVal));
+    Err = (Actual - Baud) * 1e6 / Baud;
+
+    return (Err < 0) ? -Err : Err;
+}
+
+int main(void)
+{
+    UART_BaudConfig_Type Old = { 0, 0, 1 };
+    UART_BaudConfig_Type New;
+    uint32_t Crystal;
+    uint32_t FCpu;
+    uint32_t PClk;
+    uint32_t Baud;
+    double OldErr;
+    double NewErr;
+    double WorstOld = 0;
+    double WorstNew = 0;
+    unsigned Solvable = 0;
+    unsigned Failures = 0;
+    unsigned c, m, a, b;
+
+
+    for (c = 0; c < COUNT_OF(Crystals); c++) {
+        Crystal = Crystals[c];
+
+        for (m = 1; (FCpu = Crystal * m) <= 60000000; m++) {
+            for (a = 0; a < COUNT_OF(APBDividers); a++) {
+                PClk = FCpu / APBDividers[a];
+
+                for (b = 0; b < COUNT_OF(Bauds); b++) {
+                    Baud = Bauds[b];
+
+                    Old.Divisor = (PClk + 8 * Baud) / (16 * Baud);
+                    OldErr = ErrorPPM(PClk, Baud, &Old);
+
+                    UART_CalcBaudConfig(PClk, Baud, &New);
+                    NewErr = ErrorPPM(PClk, Baud, &New);
+
+                    /* Small slack for the double arithmetic */
+                    if (NewErr > OldErr + 0.01) {
+                        printf("FAIL: %8lu Hz / %lu, %6lu baud: %.0f ppm,"
+                               " old rounding %.0f ppm\n",
+                               (unsigned long)FCpu, (unsigned long)APBDividers[a],
+                               (unsigned long)Baud, NewErr, OldErr);
+                        Failures++;
+                    }
+
+                    if (PClk < 48 * Baud) {
+                        continue;
+                    }
+
+                    Solvable++;
+                    if (OldErr > WorstOld) {
+                        WorstOld = OldErr;
+                    }
+                    if (NewErr > WorstNew) {
+                        WorstNew = NewErr;
+                    }
+
+#ifdef LPC2XXX_HAS_UART_FDR
+                    if (NewErr > MAX_ERROR_PPM) {
+                        printf("FAIL: %8lu Hz / %lu, %6lu baud: %.0f ppm"
+                               " (DL %u, DIVADDVAL %u, MULVAL %u)\n",
+                               (unsigned long)FCpu, (unsigned long)APBDividers[a],
+                               (unsigned long)Baud, NewErr,
+                               New.Divisor, New.DivAddVal, New.MulVal);
+                        Failures++;
+                    }
+#endif
+                }
+            }
+        }
+    }
+
+    printf("uart_baud_sweep: %u rates with a solution; worst %.4f%%"
+           " (old rounding %.4f%%)\n",
+           Solvable, WorstNew / 1e4, WorstOld / 1e4);
+
+    return Failures ? 1 : 0;
+}
@@ -0,0 +1,247 @@
+/******************************************************************************
+ * @file:    uart_printf_bench.c
+ * @purpose: Host-Side Check and Benchmark of UARTBuf_Printf against snprintf
+ * @version: V1.0
+ * @author:  Tymm Twillman
+ * @date:    16. October 2026
+ * @license: Simplified BSD License
+ *
+ * Notes:
+ * - UARTBuf_CommitTx() is stubbed out: it "sends" everything at once,
+ *   copying it to a capture buffer while checking and dropping it while
+ *   timing, so the ring never fills.
+ *
+ * - Every conversion the two have in common is checked against the host's
+ *   snprintf(); %q has no snprintf equivalent and is checked against fixed
+ *   strings.  Formats using widths / flags / %s precision are only checked
+ *   when built with UARTPRINTF_WIDTH non-zero.
+ *
+ * - Times are per call, averaged over BENCH_LOOPS calls; on x86 hosts the
+ *   time stamp counter is read too.  They're only good for comparing the
+ *   two here -- the ARM7 numbers will differ (no divide instruction, which
+ *   UARTBuf_Printf avoids and the C library generally doesn't).
+ *
+ * - Code size is reported by "make size", not here.
+ *
+ ******************************************************************************
+ * Copyright (c) 2012, Timothy Twillman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *        this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TIMOTHY TWILLMAN ''AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+ * NO EVENT SHALL <COPYRIGHT HOLDER> ORCONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of Timothy Twilllman.
+ *****************************************************************************/
+
+
+/* Includes -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+#endif
+
+#include "LPC2xxx.h"
+#include "LPC2xxx_uart_printf.h"
+
+
+/* Defines ------------------------------------------------------------------*/
+
+#ifndef BENCH_LOOPS
+# define BENCH_LOOPS        (200000)
+#endif
+
+#define TX_RING_SIZE        (256)
+
+
+/* Variables ----------------------------------------------------------------*/
+
+static uint8_t TxRing[TX_RING_SIZE];
+static UARTBuf_Type UB;
+
+static char Captured[TX_RING_SIZE];
+static int CapturedLen;
+static int Capture;
+
+static unsigned Checks;
+static unsigned Failures;
+
+/* Keeps the compiler from dropping the snprintf() calls */
+volatile int Sink;
+
+
+/* Functions ----------------------------------------------------------------*/
+
+/* Stand-in for the real one: the ISR empties the ring straight away */
+void UARTBuf_CommitTx(UARTBuf_Type *UB, uint16_t Head)
+{
+    if (Capture) {
+        while (UB->TxTail != Head) {
+            Captured[CapturedLen++] = UB->TxBuf[UB->TxTail++ & UB->TxMask];
+        }
+    }
+
+    UB->TxHead = Head;
+    UB->TxTail = Head;
+}
+
+static void Compare(const char *Fmt, const char *Expect, int ExpectLen,
+                    int Count)
+{
+    Checks++;
+
+    if ((CapturedLen != ExpectLen) || (Count != ExpectLen)
+     || (memcmp(Captured, Expect, ExpectLen) != 0))
+    {
+        printf("FAIL: \"%s\": got \"%.*s\" (%d), expected \"%s\" (%d)\n",
+               Fmt, CapturedLen, Captured, Count, Expect, ExpectLen);
+        Failures++;
+    }
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t Ticks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/* Check one format against snprintf() */
+#define CHECK(Fmt, ...)                                                       \
+    do {                                                                      \
+        char Ref_[TX_RING_SIZE];                                              \
+        int RefLen_ = snprintf(Ref_, sizeof(Ref_), Fmt, __VA_ARGS__);         \
+        int Count_;                                                           \
+                                                                              \
+        Capture = 1;                                                          \
+        CapturedLen = 0;                                                      \
+        Count_ = UARTBuf_Printf(&UB, Fmt, __VA_ARGS__);                       \
+        Capture = 0;                                                          \
+        Compare(Fmt, Ref_, RefLen_, Count_);                                  \
+    } while (0)
+
+/* Check one format against a fixed string */
+#define CHECK_EXPECT(Expect, Fmt, ...)                                        \
+    do {                                                                      \
+        int Count_;                                                           \
+                                                                              \
+        Capture = 1;                                                          \
+        CapturedLen = 0;                                                      \
+        Count_ = UARTBuf_Printf(&UB, Fmt, __VA_ARGS__);                       \
+        Capture = 0;                                                          \
+        Compare(Fmt, Expect, (int)strlen(Expect), Count_);                    \
+    } while (0)
+
+/* Time one format both ways */
+#define BENCH(Fmt, ...)                                                       \
+    do {                                                                      \
+        char Buf_[TX_RING_SIZE];                                              \
+        uint64_t t0_, t1_, t2_, c0_, c1_, c2_;                                \
+        long i_;                                                              \
+                                                                              \
+        t0_ = NowNs(); c0_ = Ticks();                                         \
+        for (i_ = 0; i_ < BENCH_LOOPS; i_++) {                                \
+            Sink += UARTBuf_Printf(&UB, Fmt, __VA_ARGS__);                    \
+        }                                                                     \
+        t1_ = NowNs(); c1_ = Ticks();                                         \
+        for (i_ = 0; i_ < BENCH_LOOPS; i_++) {                                \
+            Sink += snprintf(Buf_, sizeof(Buf_), Fmt, __VA_ARGS__);           \
+        }                                                                     \
+        t2_ = NowNs(); c2_ = Ticks();                                         \
+        printf("  %-28s %8.1f ns %8.1f ticks  %8.1f ns %8.1f ticks\n", Fmt,    \
+               (double)(t1_ - t0_) / BENCH_LOOPS,                             \
+               (double)(c1_ - c0_) / BENCH_LOOPS,                             \
+               (double)(t2_ - t1_) / BENCH_LOOPS,                             \
+               (double)(c2_ - c1_) / BENCH_LOOPS);                            \
+    } while (0)
+
+int main(void)
+{
+    UB.TxBuf  = TxRing;
+    UB.TxMask = TX_RING_SIZE - 1;
+
+    /* Conversions both understand */
+    CHECK("plain text, no conversions%s", "");
+    CHECK("%d %d %d %d", 0, 7, -7, 123456789);
+    CHECK("%d %i", (int)INT32_MAX, (int)INT32_MIN);
+    CHECK("%u %u", 0u, (unsigned)UINT32_MAX);
+    CHECK("%x %X %x", 0xdeadbeefu, 0xdeadbeefu, 0u);
+    CHECK("%ld %lu %lx", 42L, 42UL, 0x2aUL);
+    CHECK("%hd", 1234);
+    CHECK("%c%c%c", 'a', '%', '0');
+    CHECK("[%s] [%s]", "hello", "");
+    CHECK("100%% %s", "sure");
+
+    /* Fixed point */
+    CHECK_EXPECT("12.345", "%.3q", 12345);
+    CHECK_EXPECT("-0.005", "%.3q", -5);
+    CHECK_EXPECT("0.0", "%.1q", 0);
+    CHECK_EXPECT("42", "%q", 42);
+    CHECK_EXPECT("-2147483648", "%q", (int)INT32_MIN);
+
+#if UARTPRINTF_WIDTH
+    CHECK("[%5d] [%-5d] [%05d] [%05d]", 42, 42, 42, -42);
+    CHECK("[%*d] [%*d]", 6, 123, -6, 123);
+    CHECK("[%8x] [%08X] [%-8x]", 0xbeefu, 0xbeefu, 0xbeefu);
+    CHECK("[%10u] [%-10u]", 3000000000u, 3000000000u);
+    CHECK("[%8s] [%-8s] [%*s]", "abc", "abc", 5, "ab");
+    CHECK("[%.0s] [%.2s] [%5.1s] [%-5.3s]", "abc", "abc", "xyz", "uvwxyz");
+    CHECK("[%2s]", "longer");
+    CHECK_EXPECT("[  1.50] [-1.50  ] [-01.50]", "[%6.2q] [%-7.2q] [%06.2q]",
+                 150, -150, -150);
+#else
+    /* Widths are parsed but ignored */
+    CHECK_EXPECT("[42] [42] [abc]", "[%5d] [%-05d] [%*s]", 42, 42, 9, "abc");
+#endif
+
+    printf("uart_printf_bench (UARTPRINTF_WIDTH=%d): %u checks, %u failed\n",
+           UARTPRINTF_WIDTH, Checks, Failures);
+
+    if (Failures) {
+        return 1;
+    }
+
+    printf("  %-28s %-23s  %s\n", "per call:", "UARTBuf_Printf", "snprintf");
+    BENCH("%s", "hello, world");
+    BENCH("%d", -123456);
+    BENCH("%u,%u,%u", 1u, 22u, 333u);
+    BENCH("%x", 0xdeadbeefu);
+    BENCH("T=%d.%02d V=%d mV %s", 23, 5, 3300, "ok");
+
+    return 0;
+}